@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include "CachedModel.h"
+
+
+namespace sharemind {
+
+CachedModel::CachedModel(ExecutionModelEvaluator::Model & model)
+    : m_model(model)
+{}
+
+bool CachedModel::lookup(uint64_t parameter, double & value) const noexcept {
+    std::size_t i = slotIndex(parameter);
+    for (std::size_t probe = 0u; probe < MAX_PROBES; ++probe) {
+        const Slot & slot = m_slots[i];
+        const uint8_t state = slot.state.load(std::memory_order_acquire);
+        if (state == SLOT_EMPTY)
+            return false;
+        if (state == SLOT_READY && slot.parameter == parameter) {
+            value = slot.value;
+            return true;
+        }
+        i = (i + 1u) % NUM_SLOTS;
+    }
+    return false;
+}
+
+double CachedModel::evaluateAndInsert(uint64_t parameter) {
+    const double value = m_model.evaluate(parameter);
+
+    std::size_t i = slotIndex(parameter);
+    for (std::size_t probe = 0u; probe < MAX_PROBES; ++probe) {
+        Slot & slot = m_slots[i];
+        uint8_t state = SLOT_EMPTY;
+        if (slot.state.compare_exchange_strong(state,
+                                               SLOT_BUSY,
+                                               std::memory_order_acquire,
+                                               std::memory_order_acquire))
+        {
+            slot.parameter = parameter;
+            slot.value = value;
+            slot.state.store(SLOT_READY, std::memory_order_release);
+            break;
+        }
+        if (state == SLOT_READY && slot.parameter == parameter)
+            break; // Inserted concurrently by another process
+        i = (i + 1u) % NUM_SLOTS;
+    }
+
+    return value;
+}
+
+void CachedModel::addStatistics(uint64_t hits, uint64_t misses) noexcept {
+    m_hits.fetch_add(hits, std::memory_order_relaxed);
+    m_misses.fetch_add(misses, std::memory_order_relaxed);
+}
+
+} /* namespace sharemind { */
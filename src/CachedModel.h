@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_CACHEDMODEL_H
+#define MOD_SPDZ_FRESCO_EMU_CACHEDMODEL_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <sharemind/ExecutionModelEvaluator.h>
+#include <sharemind/visibility.h>
+
+
+namespace sharemind {
+
+/**
+ * Memoizes the values of an execution model by input size. The cache is a
+ * fixed-size insert-only open-addressing table which can be shared between
+ * threads without locking. Lookups are exact: a value is only returned for
+ * an input size it was evaluated on.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL CachedModel {
+
+private: /* Types: */
+
+    enum SlotState : uint8_t { SLOT_EMPTY, SLOT_BUSY, SLOT_READY };
+
+    struct Slot {
+        std::atomic<uint8_t> state{SLOT_EMPTY};
+        uint64_t parameter;
+        double value;
+    };
+
+    static constexpr unsigned SLOT_BITS = 9u;
+    static constexpr std::size_t NUM_SLOTS = std::size_t(1u) << SLOT_BITS;
+    static constexpr std::size_t MAX_PROBES = 16u;
+
+public: /* Methods: */
+
+    CachedModel(ExecutionModelEvaluator::Model & model);
+
+    /**
+     * \brief Looks up the cached value of the model.
+     * \returns whether the value for the parameter was cached.
+     */
+    bool lookup(uint64_t parameter, double & value) const noexcept;
+
+    /** Evaluates the model and caches the result if there is room for it. */
+    double evaluateAndInsert(uint64_t parameter);
+
+    void addStatistics(uint64_t hits, uint64_t misses) noexcept;
+
+    inline uint64_t hits() const noexcept
+    { return m_hits.load(std::memory_order_relaxed); }
+
+    inline uint64_t misses() const noexcept
+    { return m_misses.load(std::memory_order_relaxed); }
+
+private:
+
+    static inline std::size_t slotIndex(uint64_t parameter) noexcept {
+        return static_cast<std::size_t>(
+                    (parameter * UINT64_C(0x9e3779b97f4a7c15))
+                    >> (64u - SLOT_BITS));
+    }
+
+private: /* Fields: */
+
+    ExecutionModelEvaluator::Model & m_model;
+    std::array<Slot, NUM_SLOTS> m_slots;
+    std::atomic<uint64_t> m_hits{0u};
+    std::atomic<uint64_t> m_misses{0u};
+
+}; /* class CachedModel { */
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_CACHEDMODEL_H */
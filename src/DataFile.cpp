@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include "DataFile.h"
+
+
+namespace sharemind {
+
+namespace {
+
+/** Number of bytes of a file mapped into memory at once. */
+constexpr std::size_t WINDOW_SIZE = 64u * 1024u * 1024u;
+
+std::string realPath(const std::string & path) {
+    const std::unique_ptr<char, decltype(&std::free)> resolved(
+            ::realpath(path.c_str(), nullptr),
+            &std::free);
+    return resolved ? std::string(resolved.get()) : std::string();
+}
+
+[[noreturn]] void throwSystemError(const char * what) {
+    throw std::system_error(errno, std::system_category(), what);
+}
+
+} /* namespace { */
+
+std::string resolveDataFile(const std::string & directory,
+                            const std::string & name)
+{
+    if (directory.empty() || name.empty())
+        return std::string();
+
+    const std::string dir = realPath(directory);
+    if (dir.empty())
+        return std::string();
+
+    const std::string prefix = (dir.back() == '/') ? dir : dir + '/';
+    const std::string path =
+        realPath(name[0u] == '/' ? name : directory + '/' + name);
+    if (path.size() <= prefix.size()
+        || path.compare(0u, prefix.size(), prefix) != 0)
+        return std::string();
+
+    return path;
+}
+
+std::string resolveOutputDataFile(const std::string & directory,
+                                  const std::string & name)
+{
+    if (directory.empty() || name.empty())
+        return std::string();
+
+    const std::string dir = realPath(directory);
+    if (dir.empty())
+        return std::string();
+
+    const std::string::size_type slash = name.rfind('/');
+    const std::string base =
+        (slash == std::string::npos) ? name : name.substr(slash + 1u);
+    if (base.empty() || base == "." || base == "..")
+        return std::string();
+
+    std::string parent;
+    if (slash == std::string::npos) {
+        parent = dir;
+    } else if (name[0u] == '/') {
+        parent = realPath(slash == 0u ? "/" : name.substr(0u, slash));
+    } else {
+        parent = realPath(directory + '/' + name.substr(0u, slash));
+    }
+
+    const std::string prefix = (dir.back() == '/') ? dir : dir + '/';
+    if (parent != dir
+        && (parent.size() <= prefix.size()
+            || parent.compare(0u, prefix.size(), prefix) != 0))
+        return std::string();
+
+    return (parent.back() == '/') ? parent + base : parent + '/' + base;
+}
+
+InputFile::InputFile(const std::string & path)
+    : m_fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC))
+{
+    if (m_fd < 0)
+        throwSystemError("open");
+
+    struct stat st;
+    const int error = (::fstat(m_fd, &st) != 0) ? errno
+                      : !S_ISREG(st.st_mode) ? EINVAL
+                      : 0;
+    if (error != 0) {
+        ::close(m_fd);
+        throw std::system_error(error, std::system_category(), "fstat");
+    }
+    m_size = static_cast<std::uint64_t>(st.st_size);
+}
+
+InputFile::~InputFile() noexcept { ::close(m_fd); }
+
+void InputFile::read(std::uint64_t offset, void * dest, std::size_t size)
+        const
+{
+    static const std::uint64_t pageSize =
+        static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+
+    char * out = static_cast<char *>(dest);
+    while (size > 0u) {
+        // Mappings have to start at page boundaries:
+        const std::uint64_t mapOffset = offset - offset % pageSize;
+        const std::size_t skip = static_cast<std::size_t>(offset - mapOffset);
+        const std::size_t chunk = std::min(size, WINDOW_SIZE - skip);
+
+        void * const map = ::mmap(nullptr, skip + chunk, PROT_READ,
+                                  MAP_PRIVATE, m_fd,
+                                  static_cast<off_t>(mapOffset));
+        if (map == MAP_FAILED)
+            throwSystemError("mmap");
+
+        ::madvise(map, skip + chunk, MADV_SEQUENTIAL);
+        std::memcpy(out, static_cast<const char *>(map) + skip, chunk);
+        ::munmap(map, skip + chunk);
+
+        out += chunk;
+        offset += chunk;
+        size -= chunk;
+    }
+}
+
+OutputFile::OutputFile(const std::string & path)
+    : m_fd(::open(path.c_str(),
+                  O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | O_NOFOLLOW,
+                  0644))
+{
+    if (m_fd < 0)
+        throwSystemError("open");
+
+    try {
+        m_buffer.reset(new char[BUFFER_SIZE]);
+    } catch (...) {
+        ::close(m_fd);
+        throw;
+    }
+}
+
+OutputFile::~OutputFile() noexcept { ::close(m_fd); }
+
+void OutputFile::write(const void * data, std::size_t size) {
+    const char * const bytes = static_cast<const char *>(data);
+    if (size <= BUFFER_SIZE - m_used) {
+        std::memcpy(m_buffer.get() + m_used, bytes, size);
+        m_used += size;
+        return;
+    }
+
+    // Large writes bypass the buffer:
+    flush();
+    if (size < BUFFER_SIZE) {
+        std::memcpy(m_buffer.get(), bytes, size);
+        m_used = size;
+    } else {
+        writeAll(bytes, size);
+    }
+}
+
+void OutputFile::flush() {
+    writeAll(m_buffer.get(), m_used);
+    m_used = 0u;
+}
+
+void OutputFile::writeAll(const char * data, std::size_t size) {
+    while (size > 0u) {
+        const ::ssize_t written =
+            ::write(m_fd, data, std::min(size, WINDOW_SIZE));
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            throwSystemError("write");
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+} /* namespace sharemind { */
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_DATAFILE_H
+#define MOD_SPDZ_FRESCO_EMU_DATAFILE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <sharemind/visibility.h>
+
+
+namespace sharemind {
+
+/**
+ * \returns the canonical path of the named file in the directory, or an empty
+ *          string if the directory is empty, the file does not exist or the
+ *          path leads outside of the directory.
+ */
+std::string resolveDataFile(const std::string & directory,
+                            const std::string & name)
+        SHAREMIND_VISIBILITY_INTERNAL;
+
+/**
+ * \returns the path of the named file to be written in the directory, or an
+ *          empty string if the directory is empty, the name does not name a
+ *          file or its parent directory is outside of the directory.
+ * \note The file itself may not exist yet.
+ */
+std::string resolveOutputDataFile(const std::string & directory,
+                                  const std::string & name)
+        SHAREMIND_VISIBILITY_INTERNAL;
+
+/**
+ * \brief Read-only file which is mapped into memory one window at a time, so
+ *        that reading large files does not map all of them at once.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL InputFile {
+
+public: /* Methods: */
+
+    /** \throws std::system_error if the file can not be opened. */
+    explicit InputFile(const std::string & path);
+    ~InputFile() noexcept;
+
+    InputFile(const InputFile &) = delete;
+    InputFile & operator=(const InputFile &) = delete;
+
+    inline std::uint64_t size() const noexcept { return m_size; }
+
+    /**
+     * \brief Copies size bytes starting from the offset in the file to dest.
+     * \pre offset + size <= size()
+     * \throws std::system_error if mapping the file fails.
+     */
+    void read(std::uint64_t offset, void * dest, std::size_t size) const;
+
+private: /* Fields: */
+
+    int m_fd;
+    std::uint64_t m_size;
+
+}; /* class InputFile { */
+
+/**
+ * \brief Write-only file, pipe or FIFO with buffered writes.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL OutputFile {
+
+public: /* Methods: */
+
+    /**
+     * \brief Creates or truncates the file, symbolic links are not followed.
+     * \throws std::system_error if the file can not be opened.
+     */
+    explicit OutputFile(const std::string & path);
+
+    /** \note Data not written by flush() is lost. */
+    ~OutputFile() noexcept;
+
+    OutputFile(const OutputFile &) = delete;
+    OutputFile & operator=(const OutputFile &) = delete;
+
+    /** \throws std::system_error if writing fails. */
+    void write(const void * data, std::size_t size);
+
+    /**
+     * \brief Writes the value in decimal followed by a newline.
+     * \throws std::system_error if writing fails.
+     */
+    inline void writeLine(std::uint64_t value)
+    { writeDecimalLine(value, false); }
+
+    /**
+     * \brief Writes the value in decimal followed by a newline.
+     * \throws std::system_error if writing fails.
+     */
+    inline void writeLine(std::int64_t value) {
+        const std::uint64_t magnitude = static_cast<std::uint64_t>(value);
+        writeDecimalLine(value < 0 ? 0u - magnitude : magnitude, value < 0);
+    }
+
+    /** \throws std::system_error if writing fails. */
+    void flush();
+
+private: /* Methods: */
+
+    inline void writeDecimalLine(std::uint64_t magnitude, bool negative) {
+        if (BUFFER_SIZE - m_used < MAX_LINE_SIZE)
+            flush();
+
+        char digits[MAX_LINE_SIZE];
+        char * begin = digits + MAX_LINE_SIZE;
+        *--begin = '\n';
+        do {
+            *--begin = static_cast<char>('0' + magnitude % 10u);
+            magnitude /= 10u;
+        } while (magnitude != 0u);
+        if (negative)
+            *--begin = '-';
+
+        const std::size_t size =
+            static_cast<std::size_t>(digits + MAX_LINE_SIZE - begin);
+        std::copy(begin, begin + size, m_buffer.get() + m_used);
+        m_used += size;
+    }
+
+    void writeAll(const char * data, std::size_t size);
+
+private: /* Fields: */
+
+    static constexpr std::size_t BUFFER_SIZE = 1024u * 1024u;
+    static constexpr std::size_t MAX_LINE_SIZE = 21u;
+
+    int m_fd;
+    std::unique_ptr<char[]> m_buffer;
+    std::size_t m_used = 0u;
+
+}; /* class OutputFile { */
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_DATAFILE_H */
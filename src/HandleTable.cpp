@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include <cassert>
+#include "HandleTable.h"
+
+
+namespace sharemind {
+
+namespace {
+
+constexpr std::size_t INITIAL_CAPACITY = 64u;
+
+} // anonymous namespace
+
+HandleTable::HandleTable()
+    : m_entries(INITIAL_CAPACITY, Entry{emptyHandle(), 0u})
+    , m_mask(INITIAL_CAPACITY - 1u)
+{}
+
+bool HandleTable::insert(const void * handle, uint8_t heapTypeId) {
+    assert(!isReserved(handle));
+
+    // Keep at least a quarter of the slots empty to bound probe lengths:
+    if ((m_size + m_erased + 1u) * 4u > m_entries.size() * 3u)
+        rehash(m_size * 2u >= m_entries.size()
+               ? m_entries.size() * 2u
+               : m_entries.size());
+
+    Entry * target = nullptr;
+    for (std::size_t i = slotIndex(handle);; i = (i + 1u) & m_mask) {
+        Entry & entry = m_entries[i];
+        if (entry.handle == handle)
+            return false;
+        if (entry.handle == erasedHandle()) {
+            if (!target)
+                target = &entry;
+        } else if (entry.handle == emptyHandle()) {
+            if (!target) {
+                target = &entry;
+            } else {
+                --m_erased;
+            }
+            break;
+        }
+    }
+
+    target->handle = handle;
+    target->heapTypeId = heapTypeId;
+    ++m_size;
+    return true;
+}
+
+bool HandleTable::erase(const void * handle) noexcept {
+    if (isReserved(handle))
+        return false;
+
+    for (std::size_t i = slotIndex(handle);; i = (i + 1u) & m_mask) {
+        Entry & entry = m_entries[i];
+        if (entry.handle == handle) {
+            entry.handle = erasedHandle();
+            --m_size;
+            ++m_erased;
+            return true;
+        }
+        if (entry.handle == emptyHandle())
+            return false;
+    }
+}
+
+void HandleTable::rehash(std::size_t capacity) {
+    std::vector<Entry> entries(capacity, Entry{emptyHandle(), 0u});
+    entries.swap(m_entries);
+    m_mask = capacity - 1u;
+    m_erased = 0u;
+
+    for (const Entry & entry : entries) {
+        if (isReserved(entry.handle))
+            continue;
+        std::size_t i = slotIndex(entry.handle);
+        while (m_entries[i].handle != emptyHandle())
+            i = (i + 1u) & m_mask;
+        m_entries[i] = entry;
+    }
+}
+
+} /* namespace sharemind { */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_HANDLETABLE_H
+#define MOD_SPDZ_FRESCO_EMU_HANDLETABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sharemind/visibility.h>
+#include <vector>
+
+
+namespace sharemind {
+
+/**
+ * Flat open-addressing hash set of registered vector handles. The heap type
+ * ID of every vector is stored next to its handle, so validating a handle
+ * is a single probe sequence over a contiguous array in the common case.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL HandleTable {
+
+private: /* Types: */
+
+    struct Entry {
+        const void * handle;
+        uint8_t heapTypeId;
+    };
+
+public: /* Methods: */
+
+    HandleTable();
+
+    inline bool contains(const void * handle, uint8_t heapTypeId)
+            const noexcept
+    {
+        if (isReserved(handle))
+            return false;
+
+        for (std::size_t i = slotIndex(handle);; i = (i + 1u) & m_mask) {
+            const Entry & entry = m_entries[i];
+            if (entry.handle == handle)
+                return entry.heapTypeId == heapTypeId;
+            if (entry.handle == emptyHandle())
+                return false;
+        }
+    }
+
+    /** \returns false if the handle was already registered. */
+    bool insert(const void * handle, uint8_t heapTypeId);
+
+    /** \returns false if the handle was not registered. */
+    bool erase(const void * handle) noexcept;
+
+    template <typename F>
+    void forEach(F f) const {
+        for (const Entry & entry : m_entries)
+            if (!isReserved(entry.handle))
+                f(entry.handle, entry.heapTypeId);
+    }
+
+private:
+
+    static inline const void * emptyHandle() noexcept
+    { return nullptr; }
+
+    static inline const void * erasedHandle() noexcept
+    { return reinterpret_cast<const void *>(std::uintptr_t(1u)); }
+
+    static inline bool isReserved(const void * handle) noexcept
+    { return handle == emptyHandle() || handle == erasedHandle(); }
+
+    inline std::size_t slotIndex(const void * handle) const noexcept {
+        const uint64_t h = static_cast<uint64_t>(
+                    reinterpret_cast<std::uintptr_t>(handle) >> 4u);
+        return static_cast<std::size_t>(
+                    (h * UINT64_C(0x9e3779b97f4a7c15)) >> 32u) & m_mask;
+    }
+
+    void rehash(std::size_t capacity);
+
+private: /* Fields: */
+
+    std::vector<Entry> m_entries;
+    std::size_t m_mask;
+    std::size_t m_size = 0u;
+    std::size_t m_erased = 0u;
+
+}; /* class HandleTable { */
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_HANDLETABLE_H */
@@ -0,0 +1,486 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include "Arithmetic.h"
+#include "Loops.h"
+
+
+namespace sharemind {
+namespace kernels {
+
+namespace {
+
+struct Add8 {
+    static inline uint8_t scalar(uint8_t a, uint8_t b) noexcept
+    { return static_cast<uint8_t>(a + b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_add_epi8(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_add_epi8(a, b); }
+#endif
+};
+
+struct Add16 {
+    static inline uint16_t scalar(uint16_t a, uint16_t b) noexcept
+    { return static_cast<uint16_t>(a + b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_add_epi16(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_add_epi16(a, b); }
+#endif
+};
+
+struct Add32 {
+    static inline uint32_t scalar(uint32_t a, uint32_t b) noexcept
+    { return a + b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_add_epi32(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_add_epi32(a, b); }
+#endif
+};
+
+struct Add64 {
+    static inline uint64_t scalar(uint64_t a, uint64_t b) noexcept
+    { return a + b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_add_epi64(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_add_epi64(a, b); }
+#endif
+};
+
+struct Sub8 {
+    static inline uint8_t scalar(uint8_t a, uint8_t b) noexcept
+    { return static_cast<uint8_t>(a - b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_sub_epi8(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_sub_epi8(a, b); }
+#endif
+};
+
+struct Sub16 {
+    static inline uint16_t scalar(uint16_t a, uint16_t b) noexcept
+    { return static_cast<uint16_t>(a - b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_sub_epi16(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_sub_epi16(a, b); }
+#endif
+};
+
+struct Sub32 {
+    static inline uint32_t scalar(uint32_t a, uint32_t b) noexcept
+    { return a - b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_sub_epi32(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_sub_epi32(a, b); }
+#endif
+};
+
+struct Sub64 {
+    static inline uint64_t scalar(uint64_t a, uint64_t b) noexcept
+    { return a - b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_sub_epi64(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_sub_epi64(a, b); }
+#endif
+};
+
+struct Mul8 {
+    static inline uint8_t scalar(uint8_t a, uint8_t b) noexcept
+    { return static_cast<uint8_t>(a * b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    // There is no 8-bit multiplication, multiply the even and odd bytes in
+    // 16-bit lanes and keep the low bytes of the products:
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        const __m128i even = _mm_mullo_epi16(a, b);
+        const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8),
+                                            _mm_srli_epi16(b, 8));
+        return _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0xff)),
+                            _mm_slli_epi16(odd, 8));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept {
+        const __m256i even = _mm256_mullo_epi16(a, b);
+        const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8),
+                                               _mm256_srli_epi16(b, 8));
+        return _mm256_or_si256(_mm256_and_si256(even,
+                                                _mm256_set1_epi16(0xff)),
+                               _mm256_slli_epi16(odd, 8));
+    }
+#endif
+};
+
+struct Mul16 {
+    // Multiplied as unsigned, since the product may overflow int:
+    static inline uint16_t scalar(uint16_t a, uint16_t b) noexcept
+    { return static_cast<uint16_t>(static_cast<unsigned>(a) * b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_mullo_epi16(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_mullo_epi16(a, b); }
+#endif
+};
+
+struct Mul32 {
+    static inline uint32_t scalar(uint32_t a, uint32_t b) noexcept
+    { return a * b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        // SSE2 has no 32-bit low multiplication, multiply even and odd
+        // lanes separately and interleave the low halves of the products:
+        const __m128i even = _mm_mul_epu32(a, b);
+        const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4),
+                                          _mm_srli_si128(b, 4));
+        return _mm_unpacklo_epi32(
+                    _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                    _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_mullo_epi32(a, b); }
+#endif
+};
+
+struct Mul64 {
+    static inline uint64_t scalar(uint64_t a, uint64_t b) noexcept
+    { return a * b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    // a * b mod 2^64 = lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        const __m128i low = _mm_mul_epu32(a, b);
+        const __m128i cross =
+            _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b),
+                          _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+        return _mm_add_epi64(low, _mm_slli_epi64(cross, 32));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept {
+        const __m256i low = _mm256_mul_epu32(a, b);
+        const __m256i cross =
+            _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                             _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+        return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+    }
+#endif
+};
+
+/** Fused a * b + c, keeping the product in registers. */
+template <typename Mul, typename Add>
+struct MulAdd {
+    template <typename S>
+    static inline S scalar(S a, S b, S c) noexcept
+    { return Add::scalar(Mul::scalar(a, b), c); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b, __m128i c) noexcept
+    { return Add::sse2(Mul::sse2(a, b), c); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b, __m256i c) noexcept
+    { return Add::avx2(Mul::avx2(a, b), c); }
+#endif
+};
+
+using Fma8 = MulAdd<Mul8, Add8>;
+using Fma16 = MulAdd<Mul16, Add16>;
+using Fma32 = MulAdd<Mul32, Add32>;
+using Fma64 = MulAdd<Mul64, Add64>;
+
+template <typename S, typename B>
+using BinaryKernel = void (*)(const S *, B, S *, std::size_t);
+
+template <typename Op, typename S, typename B>
+BinaryKernel<S, B> selectBinary() noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<BinaryKernel<S, B> >(
+                &loops::scalarBinary<Op, S, S, B>,
+                &loops::sse2Binary<Op, S, B>,
+                &loops::avx2Binary<Op, S, B>);
+#else
+    return &loops::scalarBinary<Op, S, S, B>;
+#endif
+}
+
+template <typename S, typename C>
+using TernaryKernel = void (*)(const S *, const S *, C, S *, std::size_t);
+
+template <typename Op, typename S, typename C>
+TernaryKernel<S, C> selectTernary() noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<TernaryKernel<S, C> >(
+                &loops::scalarTernary<Op, S, C>,
+                &loops::sse2Ternary<Op, S, C>,
+                &loops::avx2Ternary<Op, S, C>);
+#else
+    return &loops::scalarTernary<Op, S, C>;
+#endif
+}
+
+template <typename S>
+using ReductionKernel = S (*)(const S *, std::size_t, S);
+
+template <typename Op, typename S>
+ReductionKernel<S> selectReduction() noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<ReductionKernel<S> >(&loops::scalarReduce<Op, S>,
+                                             &loops::sse2Reduce<Op, S>,
+                                             &loops::avx2Reduce<Op, S>);
+#else
+    return &loops::scalarReduce<Op, S>;
+#endif
+}
+
+template <typename S>
+inline void scalarPrefixSum(const S * a, S * result, std::size_t size, S acc)
+        noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = acc += a[i];
+}
+
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+
+/*
+ * The SSE2 prefix sums add shifted copies of the vector to itself to get the
+ * in-register prefix sums, and carry the last lane over to the next vector.
+ * The dependency on the carry makes wider vectors no faster.
+ */
+
+inline void sse2PrefixSum(const uint8_t * a,
+                          uint8_t * result,
+                          std::size_t size) noexcept
+{
+    __m128i carry = _mm_setzero_si128();
+    std::size_t i = 0u;
+    for (; i + 16u <= size; i += 16u) {
+        __m128i x = loops::sse2Load(a, i);
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 1));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 2));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi8(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), x);
+        carry = _mm_shuffle_epi32(
+                    _mm_shufflehi_epi16(_mm_unpackhi_epi8(x, x),
+                                        _MM_SHUFFLE(3, 3, 3, 3)),
+                    _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    scalarPrefixSum(a + i, result + i, size - i,
+                    static_cast<uint8_t>(_mm_cvtsi128_si32(carry)));
+}
+
+inline void sse2PrefixSum(const uint16_t * a,
+                          uint16_t * result,
+                          std::size_t size) noexcept
+{
+    __m128i carry = _mm_setzero_si128();
+    std::size_t i = 0u;
+    for (; i + 8u <= size; i += 8u) {
+        __m128i x = loops::sse2Load(a, i);
+        x = _mm_add_epi16(x, _mm_slli_si128(x, 2));
+        x = _mm_add_epi16(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi16(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi16(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), x);
+        carry = _mm_shuffle_epi32(_mm_shufflehi_epi16(x,
+                                                      _MM_SHUFFLE(3, 3, 3, 3)),
+                                  _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    scalarPrefixSum(a + i, result + i, size - i,
+                    static_cast<uint16_t>(_mm_cvtsi128_si32(carry)));
+}
+
+inline void sse2PrefixSum(const uint32_t * a,
+                          uint32_t * result,
+                          std::size_t size) noexcept
+{
+    __m128i carry = _mm_setzero_si128();
+    std::size_t i = 0u;
+    for (; i + 4u <= size; i += 4u) {
+        __m128i x = loops::sse2Load(a, i);
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), x);
+        carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    scalarPrefixSum(a + i, result + i, size - i,
+                    static_cast<uint32_t>(_mm_cvtsi128_si32(carry)));
+}
+
+inline void sse2PrefixSum(const uint64_t * a,
+                          uint64_t * result,
+                          std::size_t size) noexcept
+{
+    __m128i carry = _mm_setzero_si128();
+    std::size_t i = 0u;
+    for (; i + 2u <= size; i += 2u) {
+        __m128i x = loops::sse2Load(a, i);
+        x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi64(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), x);
+        carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    scalarPrefixSum(a + i, result + i, size - i,
+                    static_cast<uint64_t>(_mm_cvtsi128_si64(carry)));
+}
+
+#endif /* SPDZ_FRESCO_EMU_X86_64_KERNELS */
+
+} // anonymous namespace
+
+#define SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(name,type,Op) \
+    void name(const type * a, \
+              const type * b, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        static const BinaryKernel<type, const type *> kernel = \
+            selectBinary<Op, type, const type *>(); \
+        kernel(a, b, result, size); \
+    } \
+    void name(const type * a, \
+              type b, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        using B = loops::Broadcast<type>; \
+        static const BinaryKernel<type, B> kernel = \
+            selectBinary<Op, type, B>(); \
+        kernel(a, B{b}, result, size); \
+    }
+
+#define SPDZ_FRESCO_EMU_DEFINE_TERNARY_KERNEL(name,type,Op) \
+    void name(const type * a, \
+              const type * b, \
+              const type * c, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        static const TernaryKernel<type, const type *> kernel = \
+            selectTernary<Op, type, const type *>(); \
+        kernel(a, b, c, result, size); \
+    } \
+    void name(const type * a, \
+              const type * b, \
+              type c, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        using C = loops::Broadcast<type>; \
+        static const TernaryKernel<type, C> kernel = \
+            selectTernary<Op, type, C>(); \
+        kernel(a, b, C{c}, result, size); \
+    }
+
+#define SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(name,type,Op,identity) \
+    type name(const type * a, std::size_t size) noexcept { \
+        static const ReductionKernel<type> kernel = \
+            selectReduction<Op, type>(); \
+        return kernel(a, size, identity); \
+    }
+
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(add, uint8_t, Add8)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(add, uint16_t, Add16)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(add, uint32_t, Add32)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(add, uint64_t, Add64)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(sub, uint8_t, Sub8)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(sub, uint16_t, Sub16)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(sub, uint32_t, Sub32)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(sub, uint64_t, Sub64)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(mul, uint8_t, Mul8)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(mul, uint16_t, Mul16)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(mul, uint32_t, Mul32)
+SPDZ_FRESCO_EMU_DEFINE_BINARY_KERNEL(mul, uint64_t, Mul64)
+SPDZ_FRESCO_EMU_DEFINE_TERNARY_KERNEL(fma, uint8_t, Fma8)
+SPDZ_FRESCO_EMU_DEFINE_TERNARY_KERNEL(fma, uint16_t, Fma16)
+SPDZ_FRESCO_EMU_DEFINE_TERNARY_KERNEL(fma, uint32_t, Fma32)
+SPDZ_FRESCO_EMU_DEFINE_TERNARY_KERNEL(fma, uint64_t, Fma64)
+SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(sum, uint8_t, Add8, 0u)
+SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(sum, uint16_t, Add16, 0u)
+SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(sum, uint32_t, Add32, 0u)
+SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(sum, uint64_t, Add64, 0u)
+SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(product, uint8_t, Mul8, 1u)
+SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(product, uint16_t, Mul16, 1u)
+SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(product, uint32_t, Mul32, 1u)
+SPDZ_FRESCO_EMU_DEFINE_REDUCTION_KERNEL(product, uint64_t, Mul64, 1u)
+
+void prefixSum(const uint8_t * a, uint8_t * result, std::size_t size)
+        noexcept
+{
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    sse2PrefixSum(a, result, size);
+#else
+    scalarPrefixSum(a, result, size, uint8_t(0u));
+#endif
+}
+
+void prefixSum(const uint16_t * a, uint16_t * result, std::size_t size)
+        noexcept
+{
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    sse2PrefixSum(a, result, size);
+#else
+    scalarPrefixSum(a, result, size, uint16_t(0u));
+#endif
+}
+
+void prefixSum(const uint32_t * a, uint32_t * result, std::size_t size)
+        noexcept
+{
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    sse2PrefixSum(a, result, size);
+#else
+    scalarPrefixSum(a, result, size, uint32_t(0u));
+#endif
+}
+
+void prefixSum(const uint64_t * a, uint64_t * result, std::size_t size)
+        noexcept
+{
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    sse2PrefixSum(a, result, size);
+#else
+    scalarPrefixSum(a, result, size, uint64_t(0u));
+#endif
+}
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
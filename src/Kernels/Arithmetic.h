@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_ARITHMETIC_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_ARITHMETIC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sharemind/visibility.h>
+#include <type_traits>
+
+
+/**
+ * Elementwise arithmetic on contiguous share arrays. The result array may
+ * be the same as one of the arguments, but must not overlap them otherwise.
+ * The overloads taking a scalar right-hand operand apply it to every
+ * element.
+ */
+
+namespace sharemind {
+namespace kernels {
+
+#define SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            const type * b, \
+                                            type * result, \
+                                            std::size_t size) noexcept; \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            type b, \
+                                            type * result, \
+                                            std::size_t size) noexcept;
+
+#define SPDZ_FRESCO_EMU_DECLARE_TERNARY_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            const type * b, \
+                                            const type * c, \
+                                            type * result, \
+                                            std::size_t size) noexcept; \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            const type * b, \
+                                            type c, \
+                                            type * result, \
+                                            std::size_t size) noexcept;
+
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(add, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(add, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(add, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(add, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(sub, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(sub, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(sub, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(sub, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(mul, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(mul, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(mul, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BINARY_KERNEL(mul, uint64_t)
+
+#define SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL type name(const type * a, \
+                                            std::size_t size) noexcept;
+
+#define SPDZ_FRESCO_EMU_DECLARE_SCAN_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            type * result, \
+                                            std::size_t size) noexcept;
+
+/** Computes a * b + c. */
+SPDZ_FRESCO_EMU_DECLARE_TERNARY_KERNEL(fma, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_TERNARY_KERNEL(fma, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_TERNARY_KERNEL(fma, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_TERNARY_KERNEL(fma, uint64_t)
+
+/** Reductions of the whole array, 0 and 1 respectively for empty arrays. */
+SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(sum, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(sum, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(sum, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(sum, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(product, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(product, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(product, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_REDUCTION_KERNEL(product, uint64_t)
+
+/** Inclusive prefix sums, the result may be the same array as a. */
+SPDZ_FRESCO_EMU_DECLARE_SCAN_KERNEL(prefixSum, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_SCAN_KERNEL(prefixSum, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_SCAN_KERNEL(prefixSum, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_SCAN_KERNEL(prefixSum, uint64_t)
+
+/*
+ * Signed arithmetic wraps around like unsigned arithmetic in two's
+ * complement, so the signed kernels run the unsigned kernels of the same
+ * width on the representations of the values.
+ */
+
+inline const uint32_t * unsignedArray(const int32_t * a) noexcept
+{ return reinterpret_cast<const uint32_t *>(a); }
+inline uint32_t * unsignedArray(int32_t * a) noexcept
+{ return reinterpret_cast<uint32_t *>(a); }
+inline const uint64_t * unsignedArray(const int64_t * a) noexcept
+{ return reinterpret_cast<const uint64_t *>(a); }
+inline uint64_t * unsignedArray(int64_t * a) noexcept
+{ return reinterpret_cast<uint64_t *>(a); }
+
+#define SPDZ_FRESCO_EMU_DEFINE_SIGNED_BINARY_KERNEL(name,type,U) \
+    inline void name(const type * a, \
+                     const type * b, \
+                     type * result, \
+                     std::size_t size) noexcept \
+    { \
+        name(unsignedArray(a), unsignedArray(b), unsignedArray(result), \
+             size); \
+    } \
+    inline void name(const type * a, \
+                     type b, \
+                     type * result, \
+                     std::size_t size) noexcept \
+    { \
+        name(unsignedArray(a), static_cast<U>(b), unsignedArray(result), \
+             size); \
+    }
+
+#define SPDZ_FRESCO_EMU_DEFINE_SIGNED_KERNELS(type,U) \
+    SPDZ_FRESCO_EMU_DEFINE_SIGNED_BINARY_KERNEL(add, type, U) \
+    SPDZ_FRESCO_EMU_DEFINE_SIGNED_BINARY_KERNEL(sub, type, U) \
+    SPDZ_FRESCO_EMU_DEFINE_SIGNED_BINARY_KERNEL(mul, type, U) \
+    inline void fma(const type * a, \
+                    const type * b, \
+                    const type * c, \
+                    type * result, \
+                    std::size_t size) noexcept \
+    { \
+        fma(unsignedArray(a), unsignedArray(b), unsignedArray(c), \
+            unsignedArray(result), size); \
+    } \
+    inline void fma(const type * a, \
+                    const type * b, \
+                    type c, \
+                    type * result, \
+                    std::size_t size) noexcept \
+    { \
+        fma(unsignedArray(a), unsignedArray(b), static_cast<U>(c), \
+            unsignedArray(result), size); \
+    } \
+    inline type sum(const type * a, std::size_t size) noexcept \
+    { return static_cast<type>(sum(unsignedArray(a), size)); } \
+    inline type product(const type * a, std::size_t size) noexcept \
+    { return static_cast<type>(product(unsignedArray(a), size)); } \
+    inline void prefixSum(const type * a, \
+                          type * result, \
+                          std::size_t size) noexcept \
+    { prefixSum(unsignedArray(a), unsignedArray(result), size); }
+
+SPDZ_FRESCO_EMU_DEFINE_SIGNED_KERNELS(int32_t, uint32_t)
+SPDZ_FRESCO_EMU_DEFINE_SIGNED_KERNELS(int64_t, uint64_t)
+
+#undef SPDZ_FRESCO_EMU_DEFINE_SIGNED_KERNELS
+#undef SPDZ_FRESCO_EMU_DEFINE_SIGNED_BINARY_KERNEL
+
+/**
+ * \returns a + b and a * b respectively with the wraparound of the unsigned
+ *          arithmetic, also for signed types.
+ */
+template <typename S>
+inline S wrappingAdd(S a, S b) noexcept {
+    using U = typename std::common_type<typename std::make_unsigned<S>::type,
+                                        unsigned>::type;
+    return static_cast<S>(static_cast<U>(a) + static_cast<U>(b));
+}
+
+template <typename S>
+inline S wrappingMul(S a, S b) noexcept {
+    using U = typename std::common_type<typename std::make_unsigned<S>::type,
+                                        unsigned>::type;
+    return static_cast<S>(static_cast<U>(a) * static_cast<U>(b));
+}
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_ARITHMETIC_H */
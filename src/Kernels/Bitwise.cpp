@@ -0,0 +1,483 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include "Bitwise.h"
+
+#include <bitset>
+#include <cstring>
+#include "Loops.h"
+
+
+namespace sharemind {
+namespace kernels {
+
+namespace {
+
+/**
+ * Right-hand operand of a shift by the same count for every element. The
+ * SSE2 and AVX2 shifts by a uniform count take the count from the low 64
+ * bits of a vector, so the count is loaded there instead of broadcast.
+ */
+template <typename S>
+struct ShiftCount {
+    S value;
+};
+
+template <typename S>
+inline S element(ShiftCount<S> b, std::size_t) noexcept { return b.value; }
+
+template <typename S>
+inline ShiftCount<S> offset(ShiftCount<S> b, std::size_t) noexcept
+{ return b; }
+
+template <typename S>
+struct BitwiseAnd {
+    static inline S scalar(S a, S b) noexcept { return S(a & b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_and_si128(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_and_si256(a, b); }
+#endif
+};
+
+template <typename S>
+struct BitwiseOr {
+    static inline S scalar(S a, S b) noexcept { return S(a | b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_or_si128(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_or_si256(a, b); }
+#endif
+};
+
+template <typename S>
+struct BitwiseXor {
+    static inline S scalar(S a, S b) noexcept { return S(a ^ b); }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_xor_si128(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_xor_si256(a, b); }
+#endif
+};
+
+template <typename S>
+struct BitCount {
+    static inline S scalar(S a) noexcept
+    { return static_cast<S>(std::bitset<sizeof(S) * 8u>(a).count()); }
+};
+
+template <typename S>
+inline void scalarBitExtract(const S * a,
+                             uint8_t * result,
+                             std::size_t size) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        for (std::size_t j = 0u; j < sizeof(S) * 8u; ++j)
+            *result++ = static_cast<uint8_t>((a[i] >> j) & 1u);
+}
+
+template <typename S>
+struct ShiftLeft {
+    static inline S scalar(S a, S b) noexcept
+    { return b < sizeof(S) * 8u ? S(a << b) : S(0u); }
+};
+
+template <typename S>
+struct ShiftRight {
+    static inline S scalar(S a, S b) noexcept
+    { return b < sizeof(S) * 8u ? S(a >> b) : S(0u); }
+};
+
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+
+template <typename S>
+inline __m128i sse2Load(ShiftCount<S> b, std::size_t) noexcept
+{ return _mm_set_epi64x(0, static_cast<int64_t>(b.value)); }
+
+template <typename S>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2Load(ShiftCount<S> b, std::size_t) noexcept
+{ return _mm256_castsi128_si256(sse2Load(b, 0u)); }
+
+/*
+ * The shifts of all lanes by a uniform count take the count from the low 64
+ * bits of the right-hand vector, the shifts of each lane by its own count
+ * take the count from the same lane. Both give zero for counts of at least
+ * the lane width like the scalar shifts. SSE2 has no shifts by varying
+ * counts.
+ */
+
+template <typename S> struct ShiftLeftAll;
+template <typename S> struct ShiftRightAll;
+template <typename S> struct ShiftLeftEach;
+template <typename S> struct ShiftRightEach;
+
+template <>
+struct ShiftLeftAll<uint32_t> : ShiftLeft<uint32_t> {
+    static inline __m128i sse2(__m128i a, __m128i count) noexcept
+    { return _mm_sll_epi32(a, count); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i count) noexcept
+    { return _mm256_sll_epi32(a, _mm256_castsi256_si128(count)); }
+};
+
+template <>
+struct ShiftLeftAll<uint64_t> : ShiftLeft<uint64_t> {
+    static inline __m128i sse2(__m128i a, __m128i count) noexcept
+    { return _mm_sll_epi64(a, count); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i count) noexcept
+    { return _mm256_sll_epi64(a, _mm256_castsi256_si128(count)); }
+};
+
+template <>
+struct ShiftRightAll<uint32_t> : ShiftRight<uint32_t> {
+    static inline __m128i sse2(__m128i a, __m128i count) noexcept
+    { return _mm_srl_epi32(a, count); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i count) noexcept
+    { return _mm256_srl_epi32(a, _mm256_castsi256_si128(count)); }
+};
+
+template <>
+struct ShiftRightAll<uint64_t> : ShiftRight<uint64_t> {
+    static inline __m128i sse2(__m128i a, __m128i count) noexcept
+    { return _mm_srl_epi64(a, count); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i count) noexcept
+    { return _mm256_srl_epi64(a, _mm256_castsi256_si128(count)); }
+};
+
+template <>
+struct ShiftLeftEach<uint32_t> : ShiftLeft<uint32_t> {
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i count) noexcept
+    { return _mm256_sllv_epi32(a, count); }
+};
+
+template <>
+struct ShiftLeftEach<uint64_t> : ShiftLeft<uint64_t> {
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i count) noexcept
+    { return _mm256_sllv_epi64(a, count); }
+};
+
+template <>
+struct ShiftRightEach<uint32_t> : ShiftRight<uint32_t> {
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i count) noexcept
+    { return _mm256_srlv_epi32(a, count); }
+};
+
+template <>
+struct ShiftRightEach<uint64_t> : ShiftRight<uint64_t> {
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i count) noexcept
+    { return _mm256_srlv_epi64(a, count); }
+};
+
+/*
+ * The population counts first count the bits of every byte, SSE2 by adding
+ * neighbouring bit fields and AVX2 by looking up the counts of both nibbles
+ * with a byte shuffle, and then add up the bytes of the wider lanes.
+ */
+
+inline __m128i sse2ByteCounts(__m128i a) noexcept {
+    const __m128i m1 = _mm_set1_epi8(0x55);
+    const __m128i m2 = _mm_set1_epi8(0x33);
+    const __m128i m4 = _mm_set1_epi8(0x0f);
+    a = _mm_sub_epi8(a, _mm_and_si128(_mm_srli_epi64(a, 1), m1));
+    a = _mm_add_epi8(_mm_and_si128(a, m2),
+                     _mm_and_si128(_mm_srli_epi64(a, 2), m2));
+    return _mm_and_si128(_mm_add_epi8(a, _mm_srli_epi64(a, 4)), m4);
+}
+
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2ByteCounts(__m256i a) noexcept {
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i m4 = _mm256_set1_epi8(0x0f);
+    const __m256i low = _mm256_and_si256(a, m4);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(a, 4), m4);
+    return _mm256_add_epi8(_mm256_shuffle_epi8(table, low),
+                           _mm256_shuffle_epi8(table, high));
+}
+
+template <typename S> struct PopCount;
+
+template <>
+struct PopCount<uint8_t> : BitCount<uint8_t> {
+    static inline __m128i sse2(__m128i a) noexcept
+    { return sse2ByteCounts(a); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a) noexcept
+    { return avx2ByteCounts(a); }
+};
+
+template <>
+struct PopCount<uint16_t> : BitCount<uint16_t> {
+    static inline __m128i sse2(__m128i a) noexcept {
+        const __m128i x = sse2ByteCounts(a);
+        return _mm_and_si128(_mm_add_epi16(x, _mm_srli_epi16(x, 8)),
+                             _mm_set1_epi16(0xff));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a) noexcept {
+        const __m256i x = avx2ByteCounts(a);
+        return _mm256_and_si256(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)),
+                                _mm256_set1_epi16(0xff));
+    }
+};
+
+template <>
+struct PopCount<uint32_t> : BitCount<uint32_t> {
+    static inline __m128i sse2(__m128i a) noexcept {
+        __m128i x = sse2ByteCounts(a);
+        x = _mm_add_epi16(x, _mm_srli_epi16(x, 8));
+        x = _mm_add_epi32(x, _mm_srli_epi32(x, 16));
+        return _mm_and_si128(x, _mm_set1_epi32(0xff));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a) noexcept {
+        __m256i x = avx2ByteCounts(a);
+        x = _mm256_add_epi16(x, _mm256_srli_epi16(x, 8));
+        x = _mm256_add_epi32(x, _mm256_srli_epi32(x, 16));
+        return _mm256_and_si256(x, _mm256_set1_epi32(0xff));
+    }
+};
+
+template <>
+struct PopCount<uint64_t> : BitCount<uint64_t> {
+    static inline __m128i sse2(__m128i a) noexcept
+    { return _mm_sad_epu8(sse2ByteCounts(a), _mm_setzero_si128()); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a) noexcept
+    { return _mm256_sad_epu8(avx2ByteCounts(a), _mm256_setzero_si256()); }
+};
+
+/*
+ * x86-64 is little-endian, so the bits of an array are in the same order as
+ * the bits of its bytes. The bit extractions spread every byte over eight
+ * lanes and mask a different bit in each lane.
+ */
+
+inline void sse2BitExtract(const uint8_t * a,
+                           uint8_t * result,
+                           std::size_t size) noexcept
+{
+    const __m128i bits =
+        _mm_set1_epi64x(static_cast<int64_t>(UINT64_C(0x8040201008040201)));
+    const __m128i one = _mm_set1_epi8(1);
+    std::size_t i = 0u;
+    for (; i + 2u <= size; i += 2u) {
+        uint16_t pair;
+        std::memcpy(&pair, a + i, sizeof(pair));
+        __m128i x = _mm_set1_epi16(static_cast<int16_t>(pair));
+        x = _mm_unpacklo_epi8(x, x);
+        x = _mm_unpacklo_epi16(x, x);
+        x = _mm_unpacklo_epi32(x, x);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + 8u * i),
+                         _mm_min_epu8(_mm_and_si128(x, bits), one));
+    }
+    scalarBitExtract(a + i, result + 8u * i, size - i);
+}
+
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline void avx2BitExtract(const uint8_t * a,
+                           uint8_t * result,
+                           std::size_t size) noexcept
+{
+    const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0,
+                                            1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2,
+                                            3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i bits = _mm256_set1_epi64x(
+                static_cast<int64_t>(UINT64_C(0x8040201008040201)));
+    const __m256i one = _mm256_set1_epi8(1);
+    std::size_t i = 0u;
+    for (; i + 4u <= size; i += 4u) {
+        uint32_t quad;
+        std::memcpy(&quad, a + i, sizeof(quad));
+        const __m256i x = _mm256_shuffle_epi8(
+                    _mm256_set1_epi32(static_cast<int32_t>(quad)), spread);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + 8u * i),
+                            _mm256_min_epu8(_mm256_and_si256(x, bits), one));
+    }
+    scalarBitExtract(a + i, result + 8u * i, size - i);
+}
+
+#else /* SPDZ_FRESCO_EMU_X86_64_KERNELS */
+
+template <typename S> struct PopCount : BitCount<S> {};
+template <typename S> struct ShiftLeftAll : ShiftLeft<S> {};
+template <typename S> struct ShiftRightAll : ShiftRight<S> {};
+template <typename S> struct ShiftLeftEach : ShiftLeft<S> {};
+template <typename S> struct ShiftRightEach : ShiftRight<S> {};
+
+#endif /* SPDZ_FRESCO_EMU_X86_64_KERNELS */
+
+template <typename S>
+using UnaryKernel = void (*)(const S *, S *, std::size_t);
+
+template <typename Op, typename S>
+UnaryKernel<S> selectUnary() noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<UnaryKernel<S> >(&loops::scalarUnary<Op, S>,
+                                         &loops::sse2Unary<Op, S>,
+                                         &loops::avx2Unary<Op, S>);
+#else
+    return &loops::scalarUnary<Op, S>;
+#endif
+}
+
+template <typename S, typename B>
+using BinaryKernel = void (*)(const S *, B, S *, std::size_t);
+
+template <typename Op, typename S, typename B>
+BinaryKernel<S, B> selectBinary() noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<BinaryKernel<S, B> >(
+                &loops::scalarBinary<Op, S, S, B>,
+                &loops::sse2Binary<Op, S, B>,
+                &loops::avx2Binary<Op, S, B>);
+#else
+    return &loops::scalarBinary<Op, S, S, B>;
+#endif
+}
+
+template <typename Op, typename S>
+BinaryKernel<S, const S *> selectShiftEach() noexcept {
+    using B = const S *;
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<BinaryKernel<S, B> >(
+                &loops::scalarBinary<Op, S, S, B>,
+                &loops::scalarBinary<Op, S, S, B>,
+                &loops::avx2Binary<Op, S, B>);
+#else
+    return &loops::scalarBinary<Op, S, S, B>;
+#endif
+}
+
+template <typename S>
+inline void extractBits(const S * a, uint8_t * result, std::size_t size)
+        noexcept
+{
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    using ByteKernel = void (*)(const uint8_t *, uint8_t *, std::size_t);
+    static const ByteKernel kernel =
+        selectKernel<ByteKernel>(&scalarBitExtract<uint8_t>,
+                                 &sse2BitExtract,
+                                 &avx2BitExtract);
+    kernel(reinterpret_cast<const uint8_t *>(a), result, size * sizeof(S));
+#else
+    scalarBitExtract(a, result, size);
+#endif
+}
+
+} // anonymous namespace
+
+#define SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(name,type,Op) \
+    void name(const type * a, \
+              const type * b, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        static const BinaryKernel<type, const type *> kernel = \
+            selectBinary<Op<type>, type, const type *>(); \
+        kernel(a, b, result, size); \
+    } \
+    void name(const type * a, \
+              type b, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        using B = loops::Broadcast<type>; \
+        static const BinaryKernel<type, B> kernel = \
+            selectBinary<Op<type>, type, B>(); \
+        kernel(a, B{b}, result, size); \
+    }
+
+#define SPDZ_FRESCO_EMU_DEFINE_SHIFT_KERNEL(name,type,Op) \
+    void name(const type * a, \
+              const type * b, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        static const BinaryKernel<type, const type *> kernel = \
+            selectShiftEach<Op ## Each<type>, type>(); \
+        kernel(a, b, result, size); \
+    } \
+    void name(const type * a, \
+              type b, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        using B = ShiftCount<type>; \
+        static const BinaryKernel<type, B> kernel = \
+            selectBinary<Op ## All<type>, type, B>(); \
+        kernel(a, B{b}, result, size); \
+    }
+
+#define SPDZ_FRESCO_EMU_DEFINE_BIT_COUNT_KERNEL(name,type,Op) \
+    void name(const type * a, type * result, std::size_t size) noexcept { \
+        static const UnaryKernel<type> kernel = \
+            selectUnary<Op<type>, type>(); \
+        kernel(a, result, size); \
+    }
+
+#define SPDZ_FRESCO_EMU_DEFINE_BIT_EXTRACT_KERNEL(name,type) \
+    void name(const type * a, uint8_t * result, std::size_t size) noexcept \
+    { extractBits(a, result, size); }
+
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseAnd, uint8_t, BitwiseAnd)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseAnd, uint16_t, BitwiseAnd)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseAnd, uint32_t, BitwiseAnd)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseAnd, uint64_t, BitwiseAnd)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseOr, uint8_t, BitwiseOr)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseOr, uint16_t, BitwiseOr)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseOr, uint32_t, BitwiseOr)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseOr, uint64_t, BitwiseOr)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseXor, uint8_t, BitwiseXor)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseXor, uint16_t, BitwiseXor)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseXor, uint32_t, BitwiseXor)
+SPDZ_FRESCO_EMU_DEFINE_BITWISE_KERNEL(bitwiseXor, uint64_t, BitwiseXor)
+
+SPDZ_FRESCO_EMU_DEFINE_SHIFT_KERNEL(shl, uint32_t, ShiftLeft)
+SPDZ_FRESCO_EMU_DEFINE_SHIFT_KERNEL(shl, uint64_t, ShiftLeft)
+SPDZ_FRESCO_EMU_DEFINE_SHIFT_KERNEL(shr, uint32_t, ShiftRight)
+SPDZ_FRESCO_EMU_DEFINE_SHIFT_KERNEL(shr, uint64_t, ShiftRight)
+SPDZ_FRESCO_EMU_DEFINE_BIT_COUNT_KERNEL(popcount, uint8_t, PopCount)
+SPDZ_FRESCO_EMU_DEFINE_BIT_COUNT_KERNEL(popcount, uint16_t, PopCount)
+SPDZ_FRESCO_EMU_DEFINE_BIT_COUNT_KERNEL(popcount, uint32_t, PopCount)
+SPDZ_FRESCO_EMU_DEFINE_BIT_COUNT_KERNEL(popcount, uint64_t, PopCount)
+SPDZ_FRESCO_EMU_DEFINE_BIT_EXTRACT_KERNEL(bitExtract, uint8_t)
+SPDZ_FRESCO_EMU_DEFINE_BIT_EXTRACT_KERNEL(bitExtract, uint16_t)
+SPDZ_FRESCO_EMU_DEFINE_BIT_EXTRACT_KERNEL(bitExtract, uint32_t)
+SPDZ_FRESCO_EMU_DEFINE_BIT_EXTRACT_KERNEL(bitExtract, uint64_t)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
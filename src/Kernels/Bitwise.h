@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_BITWISE_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_BITWISE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sharemind/visibility.h>
+
+
+/**
+ * Elementwise bitwise operations on contiguous share arrays. Shifting by at
+ * least the width of the type gives zero. The overloads taking a scalar
+ * right-hand operand apply it to every element. Except for bitExtract, the
+ * result array may be the same as one of the arguments, but must not overlap
+ * them otherwise.
+ */
+
+namespace sharemind {
+namespace kernels {
+
+#define SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            const type * b, \
+                                            type * result, \
+                                            std::size_t size) noexcept; \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            type b, \
+                                            type * result, \
+                                            std::size_t size) noexcept;
+
+#define SPDZ_FRESCO_EMU_DECLARE_BIT_COUNT_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            type * result, \
+                                            std::size_t size) noexcept;
+
+/**
+ * Writes the bits of every element of a as 0/1 bytes, least significant bit
+ * first, so the result array holds size times the width of the type bytes.
+ */
+#define SPDZ_FRESCO_EMU_DECLARE_BIT_EXTRACT_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            uint8_t * result, \
+                                            std::size_t size) noexcept;
+
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseAnd, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseAnd, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseAnd, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseAnd, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseOr, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseOr, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseOr, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseOr, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseXor, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseXor, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseXor, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(bitwiseXor, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(shl, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(shl, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(shr, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BITWISE_KERNEL(shr, uint64_t)
+
+SPDZ_FRESCO_EMU_DECLARE_BIT_COUNT_KERNEL(popcount, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_BIT_COUNT_KERNEL(popcount, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_BIT_COUNT_KERNEL(popcount, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BIT_COUNT_KERNEL(popcount, uint64_t)
+
+SPDZ_FRESCO_EMU_DECLARE_BIT_EXTRACT_KERNEL(bitExtract, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_BIT_EXTRACT_KERNEL(bitExtract, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_BIT_EXTRACT_KERNEL(bitExtract, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_BIT_EXTRACT_KERNEL(bitExtract, uint64_t)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_BITWISE_H */
@@ -0,0 +1,575 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include <cstring>
+#include <type_traits>
+#include "Comparison.h"
+#include "Loops.h"
+
+
+namespace sharemind {
+namespace kernels {
+
+namespace {
+
+/*
+ * Comparison operations produce all-ones masks in the lanes where the
+ * comparison holds. Unsigned orderings are computed with signed compare
+ * instructions after flipping the sign bits of both operands, signed ones use
+ * the compare instructions directly.
+ */
+
+template <typename S> struct Equal;
+template <typename S> struct Greater;
+
+template <>
+struct Equal<uint8_t> {
+    static inline bool scalar(uint8_t a, uint8_t b) noexcept
+    { return a == b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_cmpeq_epi8(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_cmpeq_epi8(a, b); }
+#endif
+};
+
+template <>
+struct Equal<uint16_t> {
+    static inline bool scalar(uint16_t a, uint16_t b) noexcept
+    { return a == b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_cmpeq_epi16(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_cmpeq_epi16(a, b); }
+#endif
+};
+
+template <>
+struct Equal<uint32_t> {
+    static inline bool scalar(uint32_t a, uint32_t b) noexcept
+    { return a == b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_cmpeq_epi32(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_cmpeq_epi32(a, b); }
+#endif
+};
+
+template <>
+struct Equal<uint64_t> {
+    static inline bool scalar(uint64_t a, uint64_t b) noexcept
+    { return a == b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        const __m128i eq32 = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(eq32,
+                             _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_cmpeq_epi64(a, b); }
+#endif
+};
+
+template <>
+struct Greater<uint8_t> {
+    static inline bool scalar(uint8_t a, uint8_t b) noexcept
+    { return a > b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        const __m128i bias = _mm_set1_epi8(INT8_MIN);
+        return _mm_cmpgt_epi8(_mm_xor_si128(a, bias),
+                              _mm_xor_si128(b, bias));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept {
+        const __m256i bias = _mm256_set1_epi8(INT8_MIN);
+        return _mm256_cmpgt_epi8(_mm256_xor_si256(a, bias),
+                                 _mm256_xor_si256(b, bias));
+    }
+#endif
+};
+
+template <>
+struct Greater<uint16_t> {
+    static inline bool scalar(uint16_t a, uint16_t b) noexcept
+    { return a > b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        const __m128i bias = _mm_set1_epi16(INT16_MIN);
+        return _mm_cmpgt_epi16(_mm_xor_si128(a, bias),
+                               _mm_xor_si128(b, bias));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept {
+        const __m256i bias = _mm256_set1_epi16(INT16_MIN);
+        return _mm256_cmpgt_epi16(_mm256_xor_si256(a, bias),
+                                  _mm256_xor_si256(b, bias));
+    }
+#endif
+};
+
+template <>
+struct Greater<uint32_t> {
+    static inline bool scalar(uint32_t a, uint32_t b) noexcept
+    { return a > b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        const __m128i bias = _mm_set1_epi32(INT32_MIN);
+        return _mm_cmpgt_epi32(_mm_xor_si128(a, bias),
+                               _mm_xor_si128(b, bias));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept {
+        const __m256i bias = _mm256_set1_epi32(INT32_MIN);
+        return _mm256_cmpgt_epi32(_mm256_xor_si256(a, bias),
+                                  _mm256_xor_si256(b, bias));
+    }
+#endif
+};
+
+template <>
+struct Greater<uint64_t> {
+    static inline bool scalar(uint64_t a, uint64_t b) noexcept
+    { return a > b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        // Compare both 32-bit halves as unsigned, then combine the results
+        // in the high halves as hi(a) > hi(b) || (hi(a) == hi(b) &&
+        // lo(a) > lo(b)) and broadcast them to the low halves:
+        const __m128i bias = _mm_set1_epi32(INT32_MIN);
+        const __m128i x = _mm_xor_si128(a, bias);
+        const __m128i y = _mm_xor_si128(b, bias);
+        const __m128i gt32 = _mm_cmpgt_epi32(x, y);
+        const __m128i eq32 = _mm_cmpeq_epi32(x, y);
+        const __m128i gt64 =
+            _mm_or_si128(gt32, _mm_and_si128(eq32, _mm_slli_epi64(gt32, 32)));
+        return _mm_shuffle_epi32(gt64, _MM_SHUFFLE(3, 3, 1, 1));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept {
+        const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+        return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias),
+                                  _mm256_xor_si256(b, bias));
+    }
+#endif
+};
+
+template <>
+struct Equal<int32_t> : Equal<uint32_t> { };
+
+template <>
+struct Equal<int64_t> : Equal<uint64_t> { };
+
+template <>
+struct Greater<int32_t> {
+    static inline bool scalar(int32_t a, int32_t b) noexcept
+    { return a > b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return _mm_cmpgt_epi32(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_cmpgt_epi32(a, b); }
+#endif
+};
+
+template <>
+struct Greater<int64_t> {
+    static inline bool scalar(int64_t a, int64_t b) noexcept
+    { return a > b; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        // As for uint64_t, except that the high halves compare as signed:
+        const __m128i bias = _mm_set1_epi64x(INT64_C(0x80000000));
+        const __m128i x = _mm_xor_si128(a, bias);
+        const __m128i y = _mm_xor_si128(b, bias);
+        const __m128i gt32 = _mm_cmpgt_epi32(x, y);
+        const __m128i eq32 = _mm_cmpeq_epi32(x, y);
+        const __m128i gt64 =
+            _mm_or_si128(gt32, _mm_and_si128(eq32, _mm_slli_epi64(gt32, 32)));
+        return _mm_shuffle_epi32(gt64, _MM_SHUFFLE(3, 3, 1, 1));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return _mm256_cmpgt_epi64(a, b); }
+#endif
+};
+
+/**
+ * Derives a comparison from Equal or Greater by optionally swapping the
+ * operands and negating the result. The negation is applied when the mask
+ * is converted to the result.
+ */
+template <typename Base, bool swapOperands, bool negateResult>
+struct Comparison {
+    static constexpr bool negate = negateResult;
+
+    template <typename S>
+    static inline bool scalar(S a, S b) noexcept {
+        return negateResult != (swapOperands
+                                ? Base::scalar(b, a)
+                                : Base::scalar(a, b));
+    }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept
+    { return swapOperands ? Base::sse2(b, a) : Base::sse2(a, b); }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept
+    { return swapOperands ? Base::avx2(b, a) : Base::avx2(a, b); }
+#endif
+};
+
+template <typename S> using Eq = Comparison<Equal<S>, false, false>;
+template <typename S> using Gt = Comparison<Greater<S>, false, false>;
+template <typename S> using Gte = Comparison<Greater<S>, true, true>;
+template <typename S> using Lt = Comparison<Greater<S>, true, false>;
+template <typename S> using Lte = Comparison<Greater<S>, false, true>;
+
+/** Keeps the smaller or, if keepGreater is set, the greater operand. */
+template <typename S, bool keepGreater>
+struct Extremum {
+    static inline S scalar(S a, S b) noexcept
+    { return (keepGreater ? (b > a) : (a > b)) ? b : a; }
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static inline __m128i sse2(__m128i a, __m128i b) noexcept {
+        const __m128i mask = keepGreater
+                             ? Greater<S>::sse2(b, a)
+                             : Greater<S>::sse2(a, b);
+        return _mm_or_si128(_mm_and_si128(mask, b),
+                            _mm_andnot_si128(mask, a));
+    }
+    SPDZ_FRESCO_EMU_TARGET_AVX2
+    static inline __m256i avx2(__m256i a, __m256i b) noexcept {
+        const __m256i mask = keepGreater
+                             ? Greater<S>::avx2(b, a)
+                             : Greater<S>::avx2(a, b);
+        return _mm256_blendv_epi8(a, b, mask);
+    }
+#endif
+};
+
+template <typename S> using Min = Extremum<S, false>;
+template <typename S> using Max = Extremum<S, true>;
+
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+
+/** Maps every 8-bit mask to 8 bytes holding its bits as 0/1 values. */
+struct ByteMaskTable {
+    ByteMaskTable() noexcept {
+        for (unsigned mask = 0u; mask < 256u; ++mask) {
+            uint8_t * const out = bytes[mask];
+            for (unsigned bit = 0u; bit < 8u; ++bit)
+                out[bit] = (mask >> bit) & 1u;
+        }
+    }
+    uint8_t bytes[256u][8u];
+};
+
+const ByteMaskTable byteMaskTable;
+
+/** Writes the lowest lanes bits of the mask as 0/1 bytes. */
+template <std::size_t lanes>
+inline void storeMaskBytes(unsigned bits, uint8_t * result) noexcept {
+    for (std::size_t j = 0u; j < lanes; j += 8u)
+        std::memcpy(result + j, byteMaskTable.bytes[(bits >> j) & 0xffu],
+                    lanes < 8u ? lanes : 8u);
+}
+
+/*
+ * The lane helpers depend only on the lane width, signed types use those of
+ * the unsigned types of the same width.
+ */
+
+template <typename S> inline __m128i sse2One() noexcept;
+template <> inline __m128i sse2One<uint8_t>() noexcept
+{ return _mm_set1_epi8(1); }
+template <> inline __m128i sse2One<uint16_t>() noexcept
+{ return _mm_set1_epi16(1); }
+template <> inline __m128i sse2One<uint32_t>() noexcept
+{ return _mm_set1_epi32(1); }
+template <> inline __m128i sse2One<uint64_t>() noexcept
+{ return _mm_set1_epi64x(1); }
+template <> inline __m128i sse2One<int32_t>() noexcept
+{ return sse2One<uint32_t>(); }
+template <> inline __m128i sse2One<int64_t>() noexcept
+{ return sse2One<uint64_t>(); }
+
+/** \returns the lane masks as the low bits of the result. */
+template <typename S> inline unsigned sse2MoveMask(__m128i mask) noexcept;
+template <> inline unsigned sse2MoveMask<uint8_t>(__m128i mask) noexcept
+{ return static_cast<unsigned>(_mm_movemask_epi8(mask)); }
+template <> inline unsigned sse2MoveMask<uint16_t>(__m128i mask) noexcept {
+    return static_cast<unsigned>(
+                _mm_movemask_epi8(_mm_packs_epi16(mask, mask))) & 0xffu;
+}
+template <> inline unsigned sse2MoveMask<uint32_t>(__m128i mask) noexcept
+{ return _mm_movemask_ps(_mm_castsi128_ps(mask)); }
+template <> inline unsigned sse2MoveMask<uint64_t>(__m128i mask) noexcept
+{ return _mm_movemask_pd(_mm_castsi128_pd(mask)); }
+template <> inline unsigned sse2MoveMask<int32_t>(__m128i mask) noexcept
+{ return sse2MoveMask<uint32_t>(mask); }
+template <> inline unsigned sse2MoveMask<int64_t>(__m128i mask) noexcept
+{ return sse2MoveMask<uint64_t>(mask); }
+
+template <typename S> inline __m256i avx2One() noexcept;
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2One<uint8_t>() noexcept
+{ return _mm256_set1_epi8(1); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2One<uint16_t>() noexcept
+{ return _mm256_set1_epi16(1); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2One<uint32_t>() noexcept
+{ return _mm256_set1_epi32(1); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2One<uint64_t>() noexcept
+{ return _mm256_set1_epi64x(1); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2One<int32_t>() noexcept
+{ return avx2One<uint32_t>(); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2One<int64_t>() noexcept
+{ return avx2One<uint64_t>(); }
+
+template <typename S> inline unsigned avx2MoveMask(__m256i mask) noexcept;
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline unsigned avx2MoveMask<uint8_t>(__m256i mask) noexcept
+{ return static_cast<unsigned>(_mm256_movemask_epi8(mask)); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline unsigned avx2MoveMask<uint16_t>(__m256i mask) noexcept {
+    // The packing works within 128-bit halves, so the second and third
+    // quarters of the byte mask hold lanes 0-7 and 8-15 respectively:
+    const unsigned bytes = static_cast<unsigned>(
+                _mm256_movemask_epi8(_mm256_packs_epi16(mask, mask)));
+    return (bytes & 0xffu) | ((bytes >> 8u) & 0xff00u);
+}
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline unsigned avx2MoveMask<uint32_t>(__m256i mask) noexcept
+{ return _mm256_movemask_ps(_mm256_castsi256_ps(mask)); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline unsigned avx2MoveMask<uint64_t>(__m256i mask) noexcept
+{ return _mm256_movemask_pd(_mm256_castsi256_pd(mask)); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline unsigned avx2MoveMask<int32_t>(__m256i mask) noexcept
+{ return avx2MoveMask<uint32_t>(mask); }
+template <> SPDZ_FRESCO_EMU_TARGET_AVX2
+inline unsigned avx2MoveMask<int64_t>(__m256i mask) noexcept
+{ return avx2MoveMask<uint64_t>(mask); }
+
+template <typename Op, typename S, typename B>
+void sse2Compare(const S * a, B b, S * result, std::size_t size) noexcept
+{
+    constexpr std::size_t lanes = sizeof(__m128i) / sizeof(S);
+    const __m128i one = sse2One<S>();
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        const __m128i mask =
+            Op::sse2(loops::sse2Load(a, i), loops::sse2Load(b, i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i),
+                         Op::negate
+                         ? _mm_andnot_si128(mask, one)
+                         : _mm_and_si128(mask, one));
+    }
+    loops::scalarBinary<Op>(a + i, loops::offset(b, i), result + i,
+                            size - i);
+}
+
+template <typename Op, typename S, typename B>
+void sse2CompareToBytes(const S * a,
+                        B b,
+                        uint8_t * result,
+                        std::size_t size) noexcept
+{
+    constexpr std::size_t lanes = sizeof(__m128i) / sizeof(S);
+    constexpr unsigned allLanes = (1u << lanes) - 1u;
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        const __m128i mask =
+            Op::sse2(loops::sse2Load(a, i), loops::sse2Load(b, i));
+        unsigned bits = sse2MoveMask<S>(mask);
+        if (Op::negate)
+            bits ^= allLanes;
+        storeMaskBytes<lanes>(bits, result + i);
+    }
+    loops::scalarBinary<Op>(a + i, loops::offset(b, i), result + i,
+                            size - i);
+}
+
+template <typename Op, typename S, typename B>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+void avx2Compare(const S * a, B b, S * result, std::size_t size) noexcept
+{
+    constexpr std::size_t lanes = sizeof(__m256i) / sizeof(S);
+    const __m256i one = avx2One<S>();
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        const __m256i mask =
+            Op::avx2(loops::avx2Load(a, i), loops::avx2Load(b, i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i),
+                            Op::negate
+                            ? _mm256_andnot_si256(mask, one)
+                            : _mm256_and_si256(mask, one));
+    }
+    loops::scalarBinary<Op>(a + i, loops::offset(b, i), result + i,
+                            size - i);
+}
+
+template <typename Op, typename S, typename B>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+void avx2CompareToBytes(const S * a,
+                        B b,
+                        uint8_t * result,
+                        std::size_t size) noexcept
+{
+    constexpr std::size_t lanes = sizeof(__m256i) / sizeof(S);
+    constexpr unsigned allLanes = (1u << lanes) - 1u;
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        const __m256i mask =
+            Op::avx2(loops::avx2Load(a, i), loops::avx2Load(b, i));
+        unsigned bits = avx2MoveMask<S>(mask);
+        if (Op::negate)
+            bits ^= allLanes;
+        storeMaskBytes<lanes>(bits, result + i);
+    }
+    loops::scalarBinary<Op>(a + i, loops::offset(b, i), result + i,
+                            size - i);
+}
+
+#endif /* SPDZ_FRESCO_EMU_X86_64_KERNELS */
+
+template <typename S, typename B, typename R>
+using ComparisonKernel = void (*)(const S *, B, R *, std::size_t);
+
+/*
+ * Results of the argument type are written as lanes of the argument width,
+ * other results as bytes. Byte arguments therefore always use the former.
+ */
+
+template <typename Op, typename S, typename B>
+ComparisonKernel<S, B, S> selectComparison(std::true_type) noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<ComparisonKernel<S, B, S> >(
+                &loops::scalarBinary<Op, S, S, B>,
+                &sse2Compare<Op, S, B>,
+                &avx2Compare<Op, S, B>);
+#else
+    return &loops::scalarBinary<Op, S, S, B>;
+#endif
+}
+
+template <typename Op, typename S, typename B>
+ComparisonKernel<S, B, uint8_t> selectComparison(std::false_type) noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<ComparisonKernel<S, B, uint8_t> >(
+                &loops::scalarBinary<Op, S, uint8_t, B>,
+                &sse2CompareToBytes<Op, S, B>,
+                &avx2CompareToBytes<Op, S, B>);
+#else
+    return &loops::scalarBinary<Op, S, uint8_t, B>;
+#endif
+}
+
+template <typename S>
+using ExtremumKernel = S (*)(const S *, std::size_t, S);
+
+template <typename Op, typename S>
+ExtremumKernel<S> selectExtremum() noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<ExtremumKernel<S> >(&loops::scalarReduce<Op, S>,
+                                            &loops::sse2Reduce<Op, S>,
+                                            &loops::avx2Reduce<Op, S>);
+#else
+    return &loops::scalarReduce<Op, S>;
+#endif
+}
+
+} // anonymous namespace
+
+#define SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name,type,resultType,Op) \
+    void name(const type * a, \
+              const type * b, \
+              resultType * result, \
+              std::size_t size) noexcept \
+    { \
+        static const ComparisonKernel<type, const type *, resultType> \
+            kernel = selectComparison<Op<type>, type, const type *>( \
+                    std::is_same<resultType, type>()); \
+        kernel(a, b, result, size); \
+    } \
+    void name(const type * a, \
+              type b, \
+              resultType * result, \
+              std::size_t size) noexcept \
+    { \
+        using B = loops::Broadcast<type>; \
+        static const ComparisonKernel<type, B, resultType> kernel = \
+            selectComparison<Op<type>, type, B>( \
+                    std::is_same<resultType, type>()); \
+        kernel(a, B{b}, result, size); \
+    }
+
+#define SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNELS(name,Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, uint8_t, uint8_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, uint16_t, uint16_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, uint32_t, uint32_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, uint64_t, uint64_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, uint16_t, uint8_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, uint32_t, uint8_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, uint64_t, uint8_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, int32_t, int32_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, int64_t, int64_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, int32_t, uint8_t, Op) \
+    SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNEL(name, int64_t, uint8_t, Op)
+
+SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNELS(eq, Eq)
+SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNELS(gt, Gt)
+SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNELS(gte, Gte)
+SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNELS(lt, Lt)
+SPDZ_FRESCO_EMU_DEFINE_COMPARISON_KERNELS(lte, Lte)
+
+#define SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(name,type,Op,identity) \
+    type name(const type * a, std::size_t size) noexcept { \
+        static const ExtremumKernel<type> kernel = \
+            selectExtremum<Op<type>, type>(); \
+        return kernel(a, size, identity); \
+    }
+
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(min, uint8_t, Min, UINT8_MAX)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(min, uint16_t, Min, UINT16_MAX)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(min, uint32_t, Min, UINT32_MAX)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(min, uint64_t, Min, UINT64_MAX)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(max, uint8_t, Max, 0u)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(max, uint16_t, Max, 0u)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(max, uint32_t, Max, 0u)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(max, uint64_t, Max, 0u)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(min, int32_t, Min, INT32_MAX)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(min, int64_t, Min, INT64_MAX)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(max, int32_t, Max, INT32_MIN)
+SPDZ_FRESCO_EMU_DEFINE_EXTREMUM_KERNEL(max, int64_t, Max, INT64_MIN)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_COMPARISON_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_COMPARISON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sharemind/visibility.h>
+
+
+/**
+ * Elementwise comparisons on contiguous share arrays. The results are
+ * written either as 0/1 values of the argument width or as 0/1 bytes. The
+ * overloads taking a scalar right-hand operand compare every element to it.
+ */
+
+namespace sharemind {
+namespace kernels {
+
+#define SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name,type,resultType) \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            const type * b, \
+                                            resultType * result, \
+                                            std::size_t size) noexcept; \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            type b, \
+                                            resultType * result, \
+                                            std::size_t size) noexcept;
+
+#define SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNELS(name) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, uint8_t, uint8_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, uint16_t, uint16_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, uint32_t, uint32_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, uint64_t, uint64_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, uint16_t, uint8_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, uint32_t, uint8_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, uint64_t, uint8_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, int32_t, int32_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, int64_t, int64_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, int32_t, uint8_t) \
+    SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNEL(name, int64_t, uint8_t)
+
+SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNELS(eq)
+SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNELS(gt)
+SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNELS(gte)
+SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNELS(lt)
+SPDZ_FRESCO_EMU_DECLARE_COMPARISON_KERNELS(lte)
+
+#define SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL type name(const type * a, \
+                                            std::size_t size) noexcept;
+
+/**
+ * Minimum and maximum of the whole array, the maximum and minimum value of
+ * the type respectively for empty arrays.
+ */
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(min, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(min, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(min, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(min, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(max, uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(max, uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(max, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(max, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(min, int32_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(min, int64_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(max, int32_t)
+SPDZ_FRESCO_EMU_DECLARE_EXTREMUM_KERNEL(max, int64_t)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_COMPARISON_H */
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include "Cpu.h"
+
+
+namespace sharemind {
+namespace kernels {
+
+InstructionSet instructionSet() noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    static const InstructionSet detected = [] {
+        __builtin_cpu_init();
+        // SSE2 is a part of the x86-64 baseline:
+        return __builtin_cpu_supports("avx2")
+               ? InstructionSet::Avx2
+               : InstructionSet::Sse2;
+    }();
+    return detected;
+#else
+    return InstructionSet::Scalar;
+#endif
+}
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_CPU_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_CPU_H
+
+#include <sharemind/visibility.h>
+
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SPDZ_FRESCO_EMU_X86_64_KERNELS
+#define SPDZ_FRESCO_EMU_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace sharemind {
+namespace kernels {
+
+enum class InstructionSet { Scalar, Sse2, Avx2 };
+
+/** \returns the best instruction set supported by the CPU. */
+SHAREMIND_VISIBILITY_INTERNAL InstructionSet instructionSet() noexcept;
+
+/** Selects the kernel implementation for the instruction set of the CPU. */
+template <typename Fn>
+inline Fn selectKernel(Fn scalar, Fn sse2, Fn avx2) noexcept {
+    switch (instructionSet()) {
+        case InstructionSet::Avx2: return avx2;
+        case InstructionSet::Sse2: return sse2;
+        default: return scalar;
+    }
+}
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_CPU_H */
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include <algorithm>
+#include "Division.h"
+#include "Loops.h"
+
+
+#ifndef __SIZEOF_INT128__
+#error "The division kernels require a 128-bit integer type."
+#endif
+
+namespace sharemind {
+namespace kernels {
+
+namespace {
+
+template <typename S> struct WideType;
+template <> struct WideType<uint32_t> { using type = uint64_t; };
+template <> struct WideType<uint64_t> { using type = unsigned __int128; };
+
+/**
+ * Reciprocal of a nonzero divisor, which gives the quotients with a high
+ * multiplication, a subtraction and shifts. See T. Granlund and
+ * P. L. Montgomery, "Division by invariant integers using multiplication".
+ */
+template <typename S>
+struct Reciprocal {
+
+    using Wide = typename WideType<S>::type;
+    static constexpr unsigned bits = sizeof(S) * 8u;
+
+    explicit Reciprocal(S d) noexcept : divisor(d) {
+        unsigned l = 0u;
+        while (l < bits && (S(1u) << l) < d)
+            ++l;
+        multiplier = static_cast<S>(
+                (((Wide(1u) << l) - d) << bits) / d + 1u);
+        shift1 = l < 1u ? l : 1u;
+        shift2 = l < 1u ? 0u : l - 1u;
+    }
+
+    static inline S mulHigh(S a, S b) noexcept
+    { return static_cast<S>((Wide(a) * b) >> bits); }
+
+    inline S quotient(S a) const noexcept {
+        const S t = mulHigh(a, multiplier);
+        return static_cast<S>((t + ((a - t) >> shift1)) >> shift2);
+    }
+
+    S divisor;
+    S multiplier;
+    unsigned shift1;
+    unsigned shift2;
+
+};
+
+template <bool remainder, typename S>
+inline S divideOne(S a, S b) noexcept {
+    if (b == 0u)
+        return 0u;
+    return remainder ? S(a % b) : S(a / b);
+}
+
+template <bool remainder, typename S>
+void divideVector(const S * a, const S * b, S * result, std::size_t size)
+        noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = divideOne<remainder>(a[i], b[i]);
+}
+
+template <bool remainder, typename S>
+void scalarDivideBy(const S * a,
+                    const Reciprocal<S> & r,
+                    S * result,
+                    std::size_t size) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i) {
+        const S q = r.quotient(a[i]);
+        result[i] = remainder ? S(a[i] - q * r.divisor) : q;
+    }
+}
+
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+
+/*
+ * The 32-bit high multiplications multiply the even and odd lanes
+ * separately into 64-bit products and merge their high halves.
+ */
+
+inline __m128i sse2MulHigh32(__m128i a, __m128i m) noexcept {
+    const __m128i even = _mm_mul_epu32(a, m);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+    return _mm_or_si128(_mm_srli_epi64(even, 32),
+                        _mm_and_si128(odd, _mm_set1_epi64x(
+                                          INT64_C(-4294967296))));
+}
+
+inline __m128i sse2MulLow32(__m128i a, __m128i m) noexcept {
+    const __m128i even = _mm_mul_epu32(a, m);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+    return _mm_or_si128(_mm_and_si128(even, _mm_set1_epi64x(0xffffffff)),
+                        _mm_slli_epi64(odd, 32));
+}
+
+template <bool remainder>
+void sse2DivideBy(const uint32_t * a,
+                  const Reciprocal<uint32_t> & r,
+                  uint32_t * result,
+                  std::size_t size) noexcept
+{
+    const __m128i d = _mm_set1_epi32(static_cast<int32_t>(r.divisor));
+    const __m128i m = _mm_set1_epi32(static_cast<int32_t>(r.multiplier));
+    const __m128i s1 = _mm_cvtsi32_si128(static_cast<int>(r.shift1));
+    const __m128i s2 = _mm_cvtsi32_si128(static_cast<int>(r.shift2));
+    std::size_t i = 0u;
+    for (; i + 4u <= size; i += 4u) {
+        const __m128i x = loops::sse2Load(a, i);
+        const __m128i t = sse2MulHigh32(x, m);
+        const __m128i q = _mm_srl_epi32(
+                    _mm_add_epi32(t, _mm_srl_epi32(_mm_sub_epi32(x, t), s1)),
+                    s2);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i),
+                         remainder
+                         ? _mm_sub_epi32(x, sse2MulLow32(q, d))
+                         : q);
+    }
+    scalarDivideBy<remainder>(a + i, r, result + i, size - i);
+}
+
+template <bool remainder>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+void avx2DivideBy(const uint32_t * a,
+                  const Reciprocal<uint32_t> & r,
+                  uint32_t * result,
+                  std::size_t size) noexcept
+{
+    const __m256i d = _mm256_set1_epi32(static_cast<int32_t>(r.divisor));
+    const __m256i m = _mm256_set1_epi32(static_cast<int32_t>(r.multiplier));
+    const __m256i highMask = _mm256_set1_epi64x(INT64_C(-4294967296));
+    const __m128i s1 = _mm_cvtsi32_si128(static_cast<int>(r.shift1));
+    const __m128i s2 = _mm_cvtsi32_si128(static_cast<int>(r.shift2));
+    std::size_t i = 0u;
+    for (; i + 8u <= size; i += 8u) {
+        const __m256i x = loops::avx2Load(a, i);
+        const __m256i even = _mm256_mul_epu32(x, m);
+        const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), m);
+        const __m256i t = _mm256_or_si256(_mm256_srli_epi64(even, 32),
+                                          _mm256_and_si256(odd, highMask));
+        const __m256i q = _mm256_srl_epi32(
+                    _mm256_add_epi32(
+                        t, _mm256_srl_epi32(_mm256_sub_epi32(x, t), s1)),
+                    s2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i),
+                            remainder
+                            ? _mm256_sub_epi32(x, _mm256_mullo_epi32(q, d))
+                            : q);
+    }
+    scalarDivideBy<remainder>(a + i, r, result + i, size - i);
+}
+
+#endif /* SPDZ_FRESCO_EMU_X86_64_KERNELS */
+
+template <typename S>
+using DivideByKernel = void (*)(const S *,
+                                const Reciprocal<S> &,
+                                S *,
+                                std::size_t);
+
+template <bool remainder>
+DivideByKernel<uint32_t> selectDivideBy() noexcept {
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+    return selectKernel<DivideByKernel<uint32_t> >(
+                &scalarDivideBy<remainder, uint32_t>,
+                &sse2DivideBy<remainder>,
+                &avx2DivideBy<remainder>);
+#else
+    return &scalarDivideBy<remainder, uint32_t>;
+#endif
+}
+
+template <bool remainder>
+void divideBy(const uint32_t * a,
+              uint32_t b,
+              uint32_t * result,
+              std::size_t size) noexcept
+{
+    static const DivideByKernel<uint32_t> kernel = selectDivideBy<remainder>();
+    kernel(a, Reciprocal<uint32_t>(b), result, size);
+}
+
+// There are no 64-bit high multiplications in SSE2 or AVX2:
+template <bool remainder>
+void divideBy(const uint64_t * a,
+              uint64_t b,
+              uint64_t * result,
+              std::size_t size) noexcept
+{ scalarDivideBy<remainder>(a, Reciprocal<uint64_t>(b), result, size); }
+
+} /* namespace { */
+
+#define SPDZ_FRESCO_EMU_DEFINE_DIVISION_KERNEL(name,type,remainder) \
+    void name(const type * a, \
+              const type * b, \
+              type * result, \
+              std::size_t size) noexcept \
+    { divideVector<remainder>(a, b, result, size); } \
+    void name(const type * a, \
+              type b, \
+              type * result, \
+              std::size_t size) noexcept \
+    { \
+        if (b == 0u) { \
+            std::fill(result, result + size, type(0u)); \
+        } else { \
+            divideBy<remainder>(a, b, result, size); \
+        } \
+    }
+
+SPDZ_FRESCO_EMU_DEFINE_DIVISION_KERNEL(div, uint32_t, false)
+SPDZ_FRESCO_EMU_DEFINE_DIVISION_KERNEL(div, uint64_t, false)
+SPDZ_FRESCO_EMU_DEFINE_DIVISION_KERNEL(mod, uint32_t, true)
+SPDZ_FRESCO_EMU_DEFINE_DIVISION_KERNEL(mod, uint64_t, true)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_DIVISION_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_DIVISION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sharemind/visibility.h>
+
+
+/**
+ * Elementwise quotients and remainders of unsigned integer division on
+ * contiguous share arrays. Dividing by zero gives zero. The overloads taking
+ * a scalar divisor multiply by its precomputed reciprocal instead of
+ * dividing. The result array may be the same as one of the arguments, but
+ * must not overlap them otherwise.
+ */
+
+namespace sharemind {
+namespace kernels {
+
+#define SPDZ_FRESCO_EMU_DECLARE_DIVISION_KERNEL(name,type) \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            const type * b, \
+                                            type * result, \
+                                            std::size_t size) noexcept; \
+    SHAREMIND_VISIBILITY_INTERNAL void name(const type * a, \
+                                            type b, \
+                                            type * result, \
+                                            std::size_t size) noexcept;
+
+SPDZ_FRESCO_EMU_DECLARE_DIVISION_KERNEL(div, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_DIVISION_KERNEL(div, uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_DIVISION_KERNEL(mod, uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_DIVISION_KERNEL(mod, uint64_t)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_DIVISION_H */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include <cmath>
+#include "FixedPoint.h"
+
+
+#ifndef __SIZEOF_INT128__
+#error "The fixed-point kernels require a 128-bit integer type."
+#endif
+
+namespace sharemind {
+namespace kernels {
+
+namespace {
+
+using Wide = __int128;
+using UnsignedWide = unsigned __int128;
+
+/**
+ * \returns the low 64 bits of the value. The conversion is done on the
+ *          unsigned type, where it is defined to wrap around.
+ */
+inline int64_t narrow(Wide value) noexcept
+{ return static_cast<int64_t>(static_cast<uint64_t>(value)); }
+
+inline int64_t mulOne(int64_t a, int64_t b, unsigned fractionalBits)
+        noexcept
+{ return narrow((Wide(a) * b) >> fractionalBits); }
+
+inline int64_t divOne(int64_t a, int64_t b, unsigned fractionalBits)
+        noexcept
+{
+    if (b == 0)
+        return 0;
+
+    const Wide n = Wide(a) * (Wide(1) << fractionalBits);
+    Wide q = n / b;
+    if (q * b != n && ((n < 0) != (b < 0)))
+        --q;
+    return narrow(q);
+}
+
+/** \returns the integer square root of the value rounded down. */
+inline uint64_t isqrt(UnsignedWide value) noexcept {
+    if (value == 0u)
+        return 0u;
+
+    // Correct the floating-point estimate with a Newton step and then by
+    // single steps, since the estimate may be off by more than one:
+    UnsignedWide r = static_cast<UnsignedWide>(
+                std::sqrt(static_cast<long double>(value)));
+    if (r == 0u)
+        r = 1u;
+    r = (r + value / r) / 2u;
+    while (r * r > value)
+        --r;
+    while ((r + 1u) * (r + 1u) <= value)
+        ++r;
+    return static_cast<uint64_t>(r);
+}
+
+} /* namespace { */
+
+void fixMul(const int64_t * a,
+            const int64_t * b,
+            int64_t * result,
+            std::size_t size,
+            unsigned fractionalBits) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = mulOne(a[i], b[i], fractionalBits);
+}
+
+void fixMul(const int64_t * a,
+            int64_t b,
+            int64_t * result,
+            std::size_t size,
+            unsigned fractionalBits) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = mulOne(a[i], b, fractionalBits);
+}
+
+void fixDiv(const int64_t * a,
+            const int64_t * b,
+            int64_t * result,
+            std::size_t size,
+            unsigned fractionalBits) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = divOne(a[i], b[i], fractionalBits);
+}
+
+void fixDiv(const int64_t * a,
+            int64_t b,
+            int64_t * result,
+            std::size_t size,
+            unsigned fractionalBits) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = divOne(a[i], b, fractionalBits);
+}
+
+void fixSqrt(const int64_t * a,
+             int64_t * result,
+             std::size_t size,
+             unsigned fractionalBits) noexcept
+{
+    // The root of a / 2^f scaled by 2^f is the root of a * 2^f, which is
+    // less than 2^63 for f < 63:
+    for (std::size_t i = 0u; i < size; ++i) {
+        result[i] = a[i] <= 0
+                    ? 0
+                    : static_cast<int64_t>(
+                          isqrt(UnsignedWide(a[i]) << fractionalBits));
+    }
+}
+
+void intToFix(const int64_t * a,
+              int64_t * result,
+              std::size_t size,
+              unsigned fractionalBits) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = narrow(Wide(a[i]) * (Wide(1) << fractionalBits));
+}
+
+void fixToInt(const int64_t * a,
+              int64_t * result,
+              std::size_t size,
+              unsigned fractionalBits) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = a[i] >> fractionalBits;
+}
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
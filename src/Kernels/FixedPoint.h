@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_FIXEDPOINT_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_FIXEDPOINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sharemind/visibility.h>
+
+
+/**
+ * Elementwise fixed-point arithmetic on contiguous share arrays. The values
+ * are two's complement integers scaled by 2^fractionalBits, where
+ * fractionalBits is less than 63. The products and quotients are computed
+ * in 128 bits, rounded towards negative infinity and wrap around if they do
+ * not fit the result. The result array may be the same as one of the
+ * arguments, but must not overlap them otherwise.
+ */
+
+namespace sharemind {
+namespace kernels {
+
+SHAREMIND_VISIBILITY_INTERNAL void fixMul(const int64_t * a,
+                                          const int64_t * b,
+                                          int64_t * result,
+                                          std::size_t size,
+                                          unsigned fractionalBits) noexcept;
+SHAREMIND_VISIBILITY_INTERNAL void fixMul(const int64_t * a,
+                                          int64_t b,
+                                          int64_t * result,
+                                          std::size_t size,
+                                          unsigned fractionalBits) noexcept;
+
+/** Division by zero results in zero. */
+SHAREMIND_VISIBILITY_INTERNAL void fixDiv(const int64_t * a,
+                                          const int64_t * b,
+                                          int64_t * result,
+                                          std::size_t size,
+                                          unsigned fractionalBits) noexcept;
+SHAREMIND_VISIBILITY_INTERNAL void fixDiv(const int64_t * a,
+                                          int64_t b,
+                                          int64_t * result,
+                                          std::size_t size,
+                                          unsigned fractionalBits) noexcept;
+
+/** Square roots of negative values are zero. */
+SHAREMIND_VISIBILITY_INTERNAL void fixSqrt(const int64_t * a,
+                                           int64_t * result,
+                                           std::size_t size,
+                                           unsigned fractionalBits) noexcept;
+
+/** Conversions between integers and fixed-point values. */
+SHAREMIND_VISIBILITY_INTERNAL void intToFix(const int64_t * a,
+                                            int64_t * result,
+                                            std::size_t size,
+                                            unsigned fractionalBits) noexcept;
+SHAREMIND_VISIBILITY_INTERNAL void fixToInt(const int64_t * a,
+                                            int64_t * result,
+                                            std::size_t size,
+                                            unsigned fractionalBits) noexcept;
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_FIXEDPOINT_H */
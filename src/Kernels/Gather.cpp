@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include "Gather.h"
+
+
+#ifdef __GNUC__
+#define SPDZ_FRESCO_EMU_PREFETCH(address,write) \
+    __builtin_prefetch((address), (write))
+#else
+#define SPDZ_FRESCO_EMU_PREFETCH(address,write) static_cast<void>(0)
+#endif
+
+namespace sharemind {
+namespace kernels {
+
+namespace {
+
+/**
+ * How many elements ahead the random accesses are prefetched. This should
+ * cover the memory latency at a few cycles per element.
+ */
+constexpr std::size_t prefetchDistance = 16u;
+
+template <typename S>
+inline void gatherImpl(const S * src,
+                       const uint64_t * indices,
+                       S * dest,
+                       std::size_t size) noexcept
+{
+    std::size_t i = 0u;
+    if (size > prefetchDistance) {
+        for (; i < size - prefetchDistance; ++i) {
+            SPDZ_FRESCO_EMU_PREFETCH(src + indices[i + prefetchDistance], 0);
+            dest[i] = src[indices[i]];
+        }
+    }
+    for (; i < size; ++i)
+        dest[i] = src[indices[i]];
+}
+
+template <typename S>
+inline void scatterImpl(const S * src,
+                        const uint64_t * indices,
+                        S * dest,
+                        std::size_t size) noexcept
+{
+    std::size_t i = 0u;
+    if (size > prefetchDistance) {
+        for (; i < size - prefetchDistance; ++i) {
+            SPDZ_FRESCO_EMU_PREFETCH(dest + indices[i + prefetchDistance], 1);
+            dest[indices[i]] = src[i];
+        }
+    }
+    for (; i < size; ++i)
+        dest[indices[i]] = src[i];
+}
+
+} // anonymous namespace
+
+bool indicesInRange(const uint64_t * indices,
+                    std::size_t size,
+                    std::size_t bound) noexcept
+{
+    // Branch-free maximum, which the compiler can vectorize:
+    uint64_t maxIndex = 0u;
+    for (std::size_t i = 0u; i < size; ++i)
+        maxIndex = indices[i] > maxIndex ? indices[i] : maxIndex;
+    return size == 0u || maxIndex < bound;
+}
+
+#define SPDZ_FRESCO_EMU_DEFINE_GATHER_KERNELS(type) \
+    void gather(const type * src, \
+                const uint64_t * indices, \
+                type * dest, \
+                std::size_t size) noexcept \
+    { gatherImpl(src, indices, dest, size); } \
+    void scatter(const type * src, \
+                 const uint64_t * indices, \
+                 type * dest, \
+                 std::size_t size) noexcept \
+    { scatterImpl(src, indices, dest, size); }
+
+SPDZ_FRESCO_EMU_DEFINE_GATHER_KERNELS(uint8_t)
+SPDZ_FRESCO_EMU_DEFINE_GATHER_KERNELS(uint16_t)
+SPDZ_FRESCO_EMU_DEFINE_GATHER_KERNELS(uint32_t)
+SPDZ_FRESCO_EMU_DEFINE_GATHER_KERNELS(uint64_t)
+SPDZ_FRESCO_EMU_DEFINE_GATHER_KERNELS(int32_t)
+SPDZ_FRESCO_EMU_DEFINE_GATHER_KERNELS(int64_t)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
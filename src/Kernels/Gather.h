@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_GATHER_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_GATHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sharemind/visibility.h>
+
+
+/**
+ * Indexed copies between contiguous share arrays. The indices must have been
+ * checked with indicesInRange() beforehand.
+ */
+
+namespace sharemind {
+namespace kernels {
+
+/** \returns whether all of the indices are less than bound. */
+SHAREMIND_VISIBILITY_INTERNAL bool indicesInRange(const uint64_t * indices,
+                                                  std::size_t size,
+                                                  std::size_t bound) noexcept;
+
+#define SPDZ_FRESCO_EMU_DECLARE_GATHER_KERNELS(type) \
+    SHAREMIND_VISIBILITY_INTERNAL void gather(const type * src, \
+                                              const uint64_t * indices, \
+                                              type * dest, \
+                                              std::size_t size) noexcept; \
+    SHAREMIND_VISIBILITY_INTERNAL void scatter(const type * src, \
+                                               const uint64_t * indices, \
+                                               type * dest, \
+                                               std::size_t size) noexcept;
+
+/*
+ * gather() sets dest[i] = src[indices[i]] and scatter() sets
+ * dest[indices[i]] = src[i] for all i < size. For duplicate scatter indices
+ * the last one wins.
+ */
+SPDZ_FRESCO_EMU_DECLARE_GATHER_KERNELS(uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_GATHER_KERNELS(uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_GATHER_KERNELS(uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_GATHER_KERNELS(uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_GATHER_KERNELS(int32_t)
+SPDZ_FRESCO_EMU_DECLARE_GATHER_KERNELS(int64_t)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_GATHER_H */
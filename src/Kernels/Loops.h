@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_LOOPS_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_LOOPS_H
+
+#include <cstddef>
+#include <cstdint>
+#include "Cpu.h"
+
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+#include <immintrin.h>
+#endif
+
+
+/**
+ * Elementwise loops shared by the kernel implementations. An operation Op
+ * provides a static scalar() function and, on x86-64, sse2() and avx2()
+ * functions operating on __m128i and __m256i respectively. The right-hand
+ * operand of binary operations is either a pointer or a Broadcast value.
+ */
+
+namespace sharemind {
+namespace kernels {
+namespace loops {
+
+/**
+ * Right-hand operand repeating a single value, passed to the loops instead
+ * of a pointer to broadcast a scalar without materializing a vector.
+ */
+template <typename S>
+struct Broadcast {
+    S value;
+};
+
+template <typename S>
+inline S element(const S * b, std::size_t i) noexcept { return b[i]; }
+
+template <typename S>
+inline S element(Broadcast<S> b, std::size_t) noexcept { return b.value; }
+
+template <typename S>
+inline const S * offset(const S * b, std::size_t i) noexcept { return b + i; }
+
+template <typename S>
+inline Broadcast<S> offset(Broadcast<S> b, std::size_t) noexcept
+{ return b; }
+
+template <typename Op, typename S>
+inline void scalarUnary(const S * a, S * result, std::size_t size) noexcept {
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = Op::scalar(a[i]);
+}
+
+template <typename Op, typename S, typename R, typename B = const S *>
+inline void scalarBinary(const S * a,
+                         B b,
+                         R * result,
+                         std::size_t size) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = Op::scalar(a[i], element(b, i));
+}
+
+template <typename Op, typename S, typename C = const S *>
+inline void scalarTernary(const S * a,
+                          const S * b,
+                          C c,
+                          S * result,
+                          std::size_t size) noexcept
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        result[i] = Op::scalar(a[i], b[i], element(c, i));
+}
+
+template <typename Op, typename S>
+inline S scalarReduce(const S * a, std::size_t size, S init) noexcept {
+    for (std::size_t i = 0u; i < size; ++i)
+        init = Op::scalar(init, a[i]);
+    return init;
+}
+
+#ifdef SPDZ_FRESCO_EMU_X86_64_KERNELS
+
+template <typename S>
+inline __m128i sse2Load(const S * b, std::size_t i) noexcept
+{ return _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i)); }
+
+inline __m128i sse2Load(Broadcast<uint8_t> b, std::size_t) noexcept
+{ return _mm_set1_epi8(static_cast<char>(b.value)); }
+
+inline __m128i sse2Load(Broadcast<uint16_t> b, std::size_t) noexcept
+{ return _mm_set1_epi16(static_cast<int16_t>(b.value)); }
+
+inline __m128i sse2Load(Broadcast<uint32_t> b, std::size_t) noexcept
+{ return _mm_set1_epi32(static_cast<int32_t>(b.value)); }
+
+inline __m128i sse2Load(Broadcast<uint64_t> b, std::size_t) noexcept
+{ return _mm_set1_epi64x(static_cast<int64_t>(b.value)); }
+
+inline __m128i sse2Load(Broadcast<int32_t> b, std::size_t) noexcept
+{ return _mm_set1_epi32(b.value); }
+
+inline __m128i sse2Load(Broadcast<int64_t> b, std::size_t) noexcept
+{ return _mm_set1_epi64x(b.value); }
+
+template <typename S>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2Load(const S * b, std::size_t i) noexcept
+{ return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i)); }
+
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2Load(Broadcast<uint8_t> b, std::size_t) noexcept
+{ return _mm256_set1_epi8(static_cast<char>(b.value)); }
+
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2Load(Broadcast<uint16_t> b, std::size_t) noexcept
+{ return _mm256_set1_epi16(static_cast<int16_t>(b.value)); }
+
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2Load(Broadcast<uint32_t> b, std::size_t) noexcept
+{ return _mm256_set1_epi32(static_cast<int32_t>(b.value)); }
+
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2Load(Broadcast<uint64_t> b, std::size_t) noexcept
+{ return _mm256_set1_epi64x(static_cast<int64_t>(b.value)); }
+
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2Load(Broadcast<int32_t> b, std::size_t) noexcept
+{ return _mm256_set1_epi32(b.value); }
+
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline __m256i avx2Load(Broadcast<int64_t> b, std::size_t) noexcept
+{ return _mm256_set1_epi64x(b.value); }
+
+template <typename Op, typename S>
+inline void sse2Unary(const S * a, S * result, std::size_t size) noexcept {
+    constexpr std::size_t lanes = sizeof(__m128i) / sizeof(S);
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i),
+                         Op::sse2(sse2Load(a, i)));
+    }
+    scalarUnary<Op>(a + i, result + i, size - i);
+}
+
+template <typename Op, typename S>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline void avx2Unary(const S * a, S * result, std::size_t size) noexcept {
+    constexpr std::size_t lanes = sizeof(__m256i) / sizeof(S);
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i),
+                            Op::avx2(avx2Load(a, i)));
+    }
+    scalarUnary<Op>(a + i, result + i, size - i);
+}
+
+template <typename Op, typename S, typename B = const S *>
+inline void sse2Binary(const S * a,
+                       B b,
+                       S * result,
+                       std::size_t size) noexcept
+{
+    constexpr std::size_t lanes = sizeof(__m128i) / sizeof(S);
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i),
+                         Op::sse2(sse2Load(a, i), sse2Load(b, i)));
+    }
+    scalarBinary<Op>(a + i, offset(b, i), result + i, size - i);
+}
+
+template <typename Op, typename S, typename B = const S *>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline void avx2Binary(const S * a,
+                       B b,
+                       S * result,
+                       std::size_t size) noexcept
+{
+    constexpr std::size_t lanes = sizeof(__m256i) / sizeof(S);
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i),
+                            Op::avx2(avx2Load(a, i), avx2Load(b, i)));
+    }
+    scalarBinary<Op>(a + i, offset(b, i), result + i, size - i);
+}
+
+template <typename Op, typename S, typename C = const S *>
+inline void sse2Ternary(const S * a,
+                        const S * b,
+                        C c,
+                        S * result,
+                        std::size_t size) noexcept
+{
+    constexpr std::size_t lanes = sizeof(__m128i) / sizeof(S);
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i),
+                         Op::sse2(sse2Load(a, i),
+                                  sse2Load(b, i),
+                                  sse2Load(c, i)));
+    }
+    scalarTernary<Op>(a + i, b + i, offset(c, i), result + i, size - i);
+}
+
+template <typename Op, typename S, typename C = const S *>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline void avx2Ternary(const S * a,
+                        const S * b,
+                        C c,
+                        S * result,
+                        std::size_t size) noexcept
+{
+    constexpr std::size_t lanes = sizeof(__m256i) / sizeof(S);
+    std::size_t i = 0u;
+    for (; i + lanes <= size; i += lanes) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i),
+                            Op::avx2(avx2Load(a, i),
+                                     avx2Load(b, i),
+                                     avx2Load(c, i)));
+    }
+    scalarTernary<Op>(a + i, b + i, offset(c, i), result + i, size - i);
+}
+
+/**
+ * Reduces the vector lanes in a single accumulator and combines the lanes of
+ * the accumulator with init at the end.
+ */
+template <typename Op, typename S>
+inline S sse2Reduce(const S * a, std::size_t size, S init) noexcept {
+    constexpr std::size_t lanes = sizeof(__m128i) / sizeof(S);
+    if (size < lanes)
+        return scalarReduce<Op>(a, size, init);
+
+    __m128i acc = sse2Load(a, 0u);
+    std::size_t i = lanes;
+    for (; i + lanes <= size; i += lanes)
+        acc = Op::sse2(acc, sse2Load(a, i));
+
+    S accLanes[lanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(accLanes), acc);
+    return scalarReduce<Op>(a + i,
+                            size - i,
+                            scalarReduce<Op>(accLanes, lanes, init));
+}
+
+template <typename Op, typename S>
+SPDZ_FRESCO_EMU_TARGET_AVX2
+inline S avx2Reduce(const S * a, std::size_t size, S init) noexcept {
+    constexpr std::size_t lanes = sizeof(__m256i) / sizeof(S);
+    if (size < lanes)
+        return scalarReduce<Op>(a, size, init);
+
+    __m256i acc = avx2Load(a, 0u);
+    std::size_t i = lanes;
+    for (; i + lanes <= size; i += lanes)
+        acc = Op::avx2(acc, avx2Load(a, i));
+
+    S accLanes[lanes];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(accLanes), acc);
+    return scalarReduce<Op>(a + i,
+                            size - i,
+                            scalarReduce<Op>(accLanes, lanes, init));
+}
+
+#endif /* SPDZ_FRESCO_EMU_X86_64_KERNELS */
+
+} /* namespace loops { */
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_LOOPS_H */
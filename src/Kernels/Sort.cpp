@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "Sort.h"
+
+
+namespace sharemind {
+namespace kernels {
+
+namespace {
+
+constexpr unsigned digitBits = 8u;
+constexpr std::size_t numBuckets = std::size_t(1u) << digitBits;
+
+/**
+ * \returns the bits of the key in an unsigned type ordered like the key,
+ *          signed keys have their sign bits flipped.
+ */
+template <typename S>
+inline typename std::make_unsigned<S>::type orderedBits(S key) noexcept {
+    using U = typename std::make_unsigned<S>::type;
+    constexpr U signBit = std::is_signed<S>::value
+                          ? U(U(1u) << (sizeof(S) * 8u - 1u))
+                          : U(0u);
+    return static_cast<U>(static_cast<U>(key) ^ signBit);
+}
+
+template <bool withValues, typename S>
+void radixSort(S * keys,
+               S * values,
+               S * keyScratch,
+               S * valueScratch,
+               std::size_t size) noexcept
+{
+    constexpr unsigned numDigits = sizeof(S) * 8u / digitBits;
+    if (size <= 1u)
+        return;
+
+    // Count the digits of all passes in a single pass over the keys:
+    std::size_t counts[numDigits][numBuckets] = {};
+    for (std::size_t i = 0u; i < size; ++i) {
+        const auto key = orderedBits(keys[i]);
+        for (unsigned d = 0u; d < numDigits; ++d)
+            ++counts[d][(key >> (d * digitBits)) & (numBuckets - 1u)];
+    }
+
+    S * src = keys;
+    S * dest = keyScratch;
+    S * valueSrc = values;
+    S * valueDest = valueScratch;
+    for (unsigned d = 0u; d < numDigits; ++d) {
+        const unsigned shift = d * digitBits;
+        std::size_t * const offsets = counts[d];
+        if (offsets[(orderedBits(src[0u]) >> shift) & (numBuckets - 1u)]
+            == size)
+            continue;
+
+        std::size_t offset = 0u;
+        for (std::size_t b = 0u; b < numBuckets; ++b) {
+            const std::size_t count = offsets[b];
+            offsets[b] = offset;
+            offset += count;
+        }
+
+        for (std::size_t i = 0u; i < size; ++i) {
+            const S key = src[i];
+            const std::size_t to =
+                offsets[(orderedBits(key) >> shift) & (numBuckets - 1u)]++;
+            dest[to] = key;
+            if (withValues)
+                valueDest[to] = valueSrc[i];
+        }
+        std::swap(src, dest);
+        std::swap(valueSrc, valueDest);
+    }
+
+    if (src != keys) {
+        std::memcpy(keys, src, size * sizeof(S));
+        if (withValues)
+            std::memcpy(values, valueSrc, size * sizeof(S));
+    }
+}
+
+} /* namespace { */
+
+#define SPDZ_FRESCO_EMU_DEFINE_SORT_KERNELS(type) \
+    void sort(type * data, type * scratch, std::size_t size) noexcept \
+    { radixSort<false>(data, data, scratch, scratch, size); } \
+    void sortByKey(type * keys, \
+                   type * values, \
+                   type * keyScratch, \
+                   type * valueScratch, \
+                   std::size_t size) noexcept \
+    { radixSort<true>(keys, values, keyScratch, valueScratch, size); }
+
+SPDZ_FRESCO_EMU_DEFINE_SORT_KERNELS(uint8_t)
+SPDZ_FRESCO_EMU_DEFINE_SORT_KERNELS(uint16_t)
+SPDZ_FRESCO_EMU_DEFINE_SORT_KERNELS(uint32_t)
+SPDZ_FRESCO_EMU_DEFINE_SORT_KERNELS(uint64_t)
+SPDZ_FRESCO_EMU_DEFINE_SORT_KERNELS(int32_t)
+SPDZ_FRESCO_EMU_DEFINE_SORT_KERNELS(int64_t)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
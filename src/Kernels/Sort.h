@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_KERNELS_SORT_H
+#define MOD_SPDZ_FRESCO_EMU_KERNELS_SORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sharemind/visibility.h>
+
+
+/**
+ * Stable ascending sorts of contiguous share arrays. The sorts are least
+ * significant digit first radix sorts over bytes, which skip the bytes all
+ * of the keys agree on. The scratch arrays must hold as many elements as the
+ * sorted arrays.
+ */
+
+namespace sharemind {
+namespace kernels {
+
+#define SPDZ_FRESCO_EMU_DECLARE_SORT_KERNELS(type) \
+    SHAREMIND_VISIBILITY_INTERNAL void sort(type * data, \
+                                            type * scratch, \
+                                            std::size_t size) noexcept; \
+    SHAREMIND_VISIBILITY_INTERNAL void sortByKey(type * keys, \
+                                                 type * values, \
+                                                 type * keyScratch, \
+                                                 type * valueScratch, \
+                                                 std::size_t size) noexcept;
+
+/*
+ * sortByKey() sorts the keys and applies the same permutation to the values,
+ * so values with equal keys keep their order.
+ */
+SPDZ_FRESCO_EMU_DECLARE_SORT_KERNELS(uint8_t)
+SPDZ_FRESCO_EMU_DECLARE_SORT_KERNELS(uint16_t)
+SPDZ_FRESCO_EMU_DECLARE_SORT_KERNELS(uint32_t)
+SPDZ_FRESCO_EMU_DECLARE_SORT_KERNELS(uint64_t)
+SPDZ_FRESCO_EMU_DECLARE_SORT_KERNELS(int32_t)
+SPDZ_FRESCO_EMU_DECLARE_SORT_KERNELS(int64_t)
+
+} /* namespace kernels { */
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_KERNELS_SORT_H */
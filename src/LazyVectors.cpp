@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include "LazyVectors.h"
+
+
+namespace sharemind {
+
+void LazyVectors::setCopy(const void * vec, const void * source) {
+    assert(vec != source);
+    assert(!find(source));
+
+    // Allocate everything first, so that failures leave the state intact:
+    std::vector<const void *> & copies = m_copies[source];
+    copies.reserve(copies.size() + 1u);
+    State & state = m_states[vec];
+
+    if (state.source != source) {
+        if (state.source)
+            removeCopy(state.source, vec);
+        state.source = source;
+        copies.push_back(vec);
+    }
+}
+
+void LazyVectors::setBroadcast(const void * vec, uint64_t value) {
+    State & state = m_states[vec];
+    if (state.source) {
+        removeCopy(state.source, vec);
+        state.source = nullptr;
+    }
+    state.value = value;
+}
+
+void LazyVectors::erase(const void * vec) noexcept {
+    const auto it = m_states.find(vec);
+    if (it == m_states.end())
+        return;
+
+    if (it->second.source)
+        removeCopy(it->second.source, vec);
+    m_states.erase(it);
+}
+
+std::vector<const void *> LazyVectors::releaseCopies(const void * source) {
+    std::vector<const void *> copies;
+    const auto it = m_copies.find(source);
+    if (it == m_copies.end())
+        return copies;
+
+    copies.swap(it->second);
+    m_copies.erase(it);
+    for (const void * vec : copies)
+        m_states.erase(vec);
+    return copies;
+}
+
+void LazyVectors::removeCopy(const void * source, const void * vec) noexcept {
+    const auto it = m_copies.find(source);
+    assert(it != m_copies.end());
+    std::vector<const void *> & copies = it->second;
+    copies.erase(std::find(copies.begin(), copies.end(), vec));
+    if (copies.empty())
+        m_copies.erase(it);
+}
+
+} /* namespace sharemind { */
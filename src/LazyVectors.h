@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_LAZYVECTORS_H
+#define MOD_SPDZ_FRESCO_EMU_LAZYVECTORS_H
+
+#include <cstdint>
+#include <sharemind/visibility.h>
+#include <unordered_map>
+#include <vector>
+
+
+namespace sharemind {
+
+/**
+ * Bookkeeping of vectors whose contents have not been written yet. A lazy
+ * vector is either a copy of a source vector or a broadcast of a single
+ * value. Sources are never lazy themselves, and every source knows its lazy
+ * copies so they can be materialized before the source changes.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL LazyVectors {
+
+public: /* Types: */
+
+    struct State {
+        /** The source vector of a copy or nullptr for a broadcast. */
+        const void * source;
+        /** The broadcast value, converted to the share type on use. */
+        uint64_t value;
+    };
+
+public: /* Methods: */
+
+    inline bool empty() const noexcept { return m_states.empty(); }
+
+    /** \returns the state of a lazy vector or nullptr. */
+    inline const State * find(const void * vec) const noexcept {
+        const auto it = m_states.find(vec);
+        return it != m_states.end() ? &it->second : nullptr;
+    }
+
+    /** \pre source is not lazy. */
+    void setCopy(const void * vec, const void * source);
+    void setBroadcast(const void * vec, uint64_t value);
+
+    /** Forgets the state of a lazy vector, if any. */
+    void erase(const void * vec) noexcept;
+
+    /**
+     * \brief Forgets all lazy copies of the source.
+     * \returns the lazy copies, which the caller must materialize.
+     */
+    std::vector<const void *> releaseCopies(const void * source);
+
+private:
+
+    void removeCopy(const void * source, const void * vec) noexcept;
+
+private: /* Fields: */
+
+    std::unordered_map<const void *, State> m_states;
+    std::unordered_map<const void *, std::vector<const void *> > m_copies;
+
+}; /* class LazyVectors { */
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_LAZYVECTORS_H */
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include <sharemind/ExecutionProfiler.h>
+#include "CachedModel.h"
+#include "ProfilingContext.h"
+#include "SpdzFrescoPD.h"
+
+
+namespace sharemind {
+
+ProfilingContext::ProfilingContext(SpdzFrescoPD & pd)
+    : m_pd(pd)
+    , m_recordsCapacity(pd.configuration().deferredProfiling()
+                        ? pd.configuration().deferredProfilingBufferSize()
+                        : 0u)
+{ m_records.reserve(m_recordsCapacity); }
+
+ProfilingContext::~ProfilingContext() noexcept {
+    for (const SyscallEntry & entry : m_entries)
+        if (entry.timeModel)
+            entry.timeModel->addStatistics(entry.cacheHits,
+                                           entry.cacheMisses);
+}
+
+void ProfilingContext::flush() {
+    for (const Record & record : m_records)
+        addSection(m_entries[static_cast<size_t>(record.id)],
+                   record.parameter);
+    m_records.clear();
+}
+
+void ProfilingContext::resolveProfiler(
+        SharemindModuleApi0x1SyscallContext * ctx)
+{
+    m_profiler = static_cast<ExecutionProfiler *>(
+                ctx->processFacility(ctx, "Profiler"));
+    m_profilerResolved = true;
+
+    if (!m_profiler)
+        return;
+
+    for (size_t i = 0u; i < NUM_SYSCALLS; ++i) {
+        const char * const name = syscallName(static_cast<SyscallId>(i));
+        SyscallEntry & entry = m_entries[i];
+        entry.timeModel = m_pd.timeModel(static_cast<SyscallId>(i));
+        if (entry.timeModel)
+            entry.sectionTypeId = m_profiler->newSectionType(name);
+    }
+}
+
+/// \todo evaluate() returns double. Make sure we can cast it to UsTime.
+void ProfilingContext::addSection(SyscallEntry & entry, size_t parameter) {
+    double time;
+    if (entry.timeModel->lookup(parameter, time)) {
+        ++entry.cacheHits;
+    } else {
+        time = entry.timeModel->evaluateAndInsert(parameter);
+        ++entry.cacheMisses;
+    }
+
+#ifdef SHAREMIND_NETWORK_STATISTICS_ENABLE
+    m_profiler->addSection(entry.sectionTypeId, parameter, 0u, time,
+                           MinerNetworkStatistics(),
+                           MinerNetworkStatistics());
+#else
+    m_profiler->addSection(entry.sectionTypeId, parameter, 0u, time);
+#endif
+}
+
+} /* namespace sharemind { */
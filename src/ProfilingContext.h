@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROFILINGCONTEXT_H
+#define MOD_SPDZ_FRESCO_EMU_PROFILINGCONTEXT_H
+
+#include <array>
+#include <cstdint>
+#include <sharemind/module-apis/api_0x1.h>
+#include <sharemind/visibility.h>
+#include <vector>
+#include "Syscalls/SyscallIds.h"
+
+
+namespace sharemind {
+
+class CachedModel;
+class ExecutionProfiler;
+class SpdzFrescoPD;
+
+/**
+ * Per-process profiling state. The profiler facility and the time models of
+ * all syscalls are resolved once, so that profiling a syscall only costs an
+ * array lookup and a model evaluation. The time models are memoized by the
+ * protection domain and shared between all of its processes.
+ *
+ * In deferred mode the syscalls are only recorded and the time models are
+ * evaluated in batches when the record buffer fills up or on flush().
+ */
+class SHAREMIND_VISIBILITY_INTERNAL ProfilingContext {
+
+private: /* Types: */
+
+    struct SyscallEntry {
+        CachedModel * timeModel = nullptr;
+        uint32_t sectionTypeId = 0u;
+        uint64_t cacheHits = 0u;
+        uint64_t cacheMisses = 0u;
+    };
+
+    struct Record {
+        uint64_t parameter;
+        SyscallId id;
+    };
+
+public: /* Methods: */
+
+    ProfilingContext(SpdzFrescoPD & pd);
+    ~ProfilingContext() noexcept;
+
+    inline void profile(SharemindModuleApi0x1SyscallContext * ctx,
+                        SyscallId id,
+                        size_t parameter)
+    {
+        if (!m_profilerResolved)
+            resolveProfiler(ctx);
+
+        if (!m_profiler)
+            return;
+
+        SyscallEntry & entry = m_entries[static_cast<size_t>(id)];
+        if (!entry.timeModel)
+            return;
+
+        if (m_recordsCapacity == 0u) {
+            addSection(entry, parameter);
+        } else {
+            m_records.push_back(Record{parameter, id});
+            if (m_records.size() == m_recordsCapacity)
+                flush();
+        }
+    }
+
+    /** Adds the profiler sections of all deferred syscalls. */
+    void flush();
+
+private:
+
+    void resolveProfiler(SharemindModuleApi0x1SyscallContext * ctx);
+    void addSection(SyscallEntry & entry, size_t parameter);
+
+private: /* Fields: */
+
+    SpdzFrescoPD & m_pd;
+    ExecutionProfiler * m_profiler = nullptr;
+    bool m_profilerResolved = false;
+    std::array<SyscallEntry, NUM_SYSCALLS> m_entries;
+    std::vector<Record> m_records;
+    const std::size_t m_recordsCapacity;
+
+}; /* class ProfilingContext { */
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROFILINGCONTEXT_H */
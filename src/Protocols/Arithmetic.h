@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_ARITHMETIC_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_ARITHMETIC_H
+
+#include <sharemind/libemulator_protocols/Binary.h>
+#include "../Kernels/Arithmetic.h"
+#include "../Kernels/Bitwise.h"
+#include "../Kernels/Division.h"
+#include "../ValueTraits.h"
+#include "KernelProtocol.h"
+
+
+namespace sharemind {
+
+struct SHAREMIND_VISIBILITY_INTERNAL AdditionKernel {
+    template <typename S, typename B>
+    static inline void invoke(const S * a, B b, S * result,
+                              std::size_t size) noexcept
+    { kernels::add(a, b, result, size); }
+};
+
+struct SHAREMIND_VISIBILITY_INTERNAL SubtractionKernel {
+    template <typename S, typename B>
+    static inline void invoke(const S * a, B b, S * result,
+                              std::size_t size) noexcept
+    { kernels::sub(a, b, result, size); }
+};
+
+struct SHAREMIND_VISIBILITY_INTERNAL MultiplicationKernel {
+    template <typename S, typename B>
+    static inline void invoke(const S * a, B b, S * result,
+                              std::size_t size) noexcept
+    { kernels::mul(a, b, result, size); }
+};
+
+struct SHAREMIND_VISIBILITY_INTERNAL FusedMultiplyAddKernel {
+    template <typename S, typename C>
+    static inline void invoke(const S * a, const S * b, C c, S * result,
+                              std::size_t size) noexcept
+    { kernels::fma(a, b, c, result, size); }
+};
+
+/** Private divisors of zero give zero, public ones are rejected. */
+struct SHAREMIND_VISIBILITY_INTERNAL IntegerDivisionKernel {
+    template <typename S, typename B>
+    static inline void invoke(const S * a, B b, S * result,
+                              std::size_t size) noexcept
+    { kernels::div(a, b, result, size); }
+    template <typename S>
+    static inline bool isValidPublic(S b) noexcept { return b != 0u; }
+};
+
+/** Private divisors of zero give zero, public ones are rejected. */
+struct SHAREMIND_VISIBILITY_INTERNAL IntegerRemainderKernel {
+    template <typename S, typename B>
+    static inline void invoke(const S * a, B b, S * result,
+                              std::size_t size) noexcept
+    { kernels::mod(a, b, result, size); }
+    template <typename S>
+    static inline bool isValidPublic(S b) noexcept { return b != 0u; }
+};
+
+/*
+ * Secret left shifts multiply by 2^b. Right shifts also truncate the
+ * product, which costs one more comparison, so the time models of shr are
+ * those of shl plus a comparison.
+ */
+struct SHAREMIND_VISIBILITY_INTERNAL ShiftLeftKernel {
+    template <typename S, typename B>
+    static inline void invoke(const S * a, B b, S * result,
+                              std::size_t size) noexcept
+    { kernels::shl(a, b, result, size); }
+};
+
+struct SHAREMIND_VISIBILITY_INTERNAL ShiftRightKernel {
+    template <typename S, typename B>
+    static inline void invoke(const S * a, B b, S * result,
+                              std::size_t size) noexcept
+    { kernels::shr(a, b, result, size); }
+};
+
+/**
+ * Computes a * b + c in a single pass. There is no corresponding protocol in
+ * libemulator_protocols, the template parameter is only there to match the
+ * syscall definitions of the other protocols.
+ */
+template <typename PDPI>
+using FusedMultiplyAddProtocol = TernaryKernelProtocol<FusedMultiplyAddKernel>;
+
+/*
+ * Integer division and shifts have no corresponding protocols in
+ * libemulator_protocols either.
+ */
+template <typename PDPI>
+using IntegerDivisionProtocol =
+        CheckedBinaryKernelProtocol<IntegerDivisionKernel>;
+template <typename PDPI>
+using IntegerRemainderProtocol =
+        CheckedBinaryKernelProtocol<IntegerRemainderKernel>;
+template <typename PDPI>
+using ShiftLeftProtocol = BinaryKernelProtocol<ShiftLeftKernel>;
+template <typename PDPI>
+using ShiftRightProtocol = BinaryKernelProtocol<ShiftRightKernel>;
+
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, AdditionProtocol, BinaryKernelProtocol<AdditionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, AdditionProtocol, BinaryKernelProtocol<AdditionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, AdditionProtocol, BinaryKernelProtocol<AdditionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, AdditionProtocol, BinaryKernelProtocol<AdditionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, SubtractionProtocol, BinaryKernelProtocol<SubtractionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, SubtractionProtocol, BinaryKernelProtocol<SubtractionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, SubtractionProtocol, BinaryKernelProtocol<SubtractionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, SubtractionProtocol, BinaryKernelProtocol<SubtractionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, MultiplicationProtocol, BinaryKernelProtocol<MultiplicationKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, MultiplicationProtocol, BinaryKernelProtocol<MultiplicationKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, MultiplicationProtocol, BinaryKernelProtocol<MultiplicationKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, MultiplicationProtocol, BinaryKernelProtocol<MultiplicationKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, AdditionProtocol, BinaryKernelProtocol<AdditionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, AdditionProtocol, BinaryKernelProtocol<AdditionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, SubtractionProtocol, BinaryKernelProtocol<SubtractionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, SubtractionProtocol, BinaryKernelProtocol<SubtractionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, MultiplicationProtocol, BinaryKernelProtocol<MultiplicationKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, MultiplicationProtocol, BinaryKernelProtocol<MultiplicationKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, AdditionProtocol, BinaryKernelProtocol<AdditionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, SubtractionProtocol, BinaryKernelProtocol<SubtractionKernel>)
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_ARITHMETIC_H */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_BITWISE_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_BITWISE_H
+
+#include <limits>
+#include "../Kernels/Bitwise.h"
+#include "../ValueTraits.h"
+#include "KernelProtocol.h"
+
+
+namespace sharemind {
+
+#define SPDZ_FRESCO_EMU_BITWISE_KERNEL(Kernel,name) \
+    struct SHAREMIND_VISIBILITY_INTERNAL Kernel { \
+        template <typename S, typename B> \
+        static inline void invoke(const S * a, B b, S * result, \
+                                  std::size_t size) noexcept \
+        { kernels::name(a, b, result, size); } \
+    };
+
+SPDZ_FRESCO_EMU_BITWISE_KERNEL(BitwiseAndKernel, bitwiseAnd)
+SPDZ_FRESCO_EMU_BITWISE_KERNEL(BitwiseOrKernel, bitwiseOr)
+SPDZ_FRESCO_EMU_BITWISE_KERNEL(BitwiseXorKernel, bitwiseXor)
+
+#undef SPDZ_FRESCO_EMU_BITWISE_KERNEL
+
+struct SHAREMIND_VISIBILITY_INTERNAL PopCountKernel {
+    template <typename S>
+    static inline void invoke(const S * a, S * result, std::size_t size)
+            noexcept
+    { kernels::popcount(a, result, size); }
+};
+
+/**
+ * Decomposes every element into a boolean vector of its bits, least
+ * significant bit first. The result vector must hold the bits of all the
+ * elements one after another. Large inputs are split across the worker pool
+ * of the protection domain.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL BitExtractKernelProtocol {
+
+public: /* Methods: */
+
+    inline BitExtractKernelProtocol(SpdzFrescoPDPI & pdpi) noexcept
+        : m_workerPool(pdpi.workerPool())
+    {}
+
+    template <typename T>
+    bool invoke(const ShareVec<T> & a, ShareVec<sf_bool_t> & result) {
+        constexpr std::size_t bits = T::num_of_bits;
+
+        if (a.size() > std::numeric_limits<std::size_t>::max() / bits
+                || a.size() * bits != result.size())
+            return false;
+
+        const auto * const pa = a.data();
+        auto * const pr = result.data();
+        m_workerPool.parallelFor(a.size(),
+            [pa, pr](std::size_t begin, std::size_t end) noexcept {
+                kernels::bitExtract(pa + begin, pr + begin * bits,
+                                    end - begin);
+            });
+        return true;
+    }
+
+private: /* Fields: */
+
+    WorkerPool & m_workerPool;
+
+}; /* class BitExtractKernelProtocol { */
+
+/*
+ * There are no corresponding protocols in libemulator_protocols, the
+ * template parameters are only there to match the syscall definitions of the
+ * other protocols. The booleans are 0/1 bytes, so the 8-bit kernels also
+ * compute their conjunction, disjunction and exclusive disjunction.
+ */
+template <typename PDPI>
+using BitwiseAndProtocol = BinaryKernelProtocol<BitwiseAndKernel>;
+template <typename PDPI>
+using BitwiseOrProtocol = BinaryKernelProtocol<BitwiseOrKernel>;
+template <typename PDPI>
+using BitwiseXorProtocol = BinaryKernelProtocol<BitwiseXorKernel>;
+template <typename PDPI>
+using PopCountProtocol = UnaryKernelProtocol<PopCountKernel>;
+template <typename PDPI>
+using BitExtractProtocol = BitExtractKernelProtocol;
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_BITWISE_H */
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_CHOICE_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_CHOICE_H
+
+#include <sharemind/libemulator_protocols/Ternary.h>
+#include "../ValueTraits.h"
+#include "KernelProtocol.h"
+
+
+namespace sharemind {
+
+/** Selects a where the condition is nonzero and b elsewhere. */
+struct SHAREMIND_VISIBILITY_INTERNAL ObliviousChoiceKernel {
+    template <typename C, typename S>
+    static inline void invoke(const C * cond,
+                              const S * a,
+                              const S * b,
+                              S * result,
+                              std::size_t size) noexcept
+    {
+        for (std::size_t i = 0u; i < size; ++i)
+            result[i] = cond[i] ? a[i] : b[i];
+    }
+};
+
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_bool_t, ObliviousChoiceProtocol, TernaryKernelProtocol<ObliviousChoiceKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, ObliviousChoiceProtocol, TernaryKernelProtocol<ObliviousChoiceKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, ObliviousChoiceProtocol, TernaryKernelProtocol<ObliviousChoiceKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, ObliviousChoiceProtocol, TernaryKernelProtocol<ObliviousChoiceKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, ObliviousChoiceProtocol, TernaryKernelProtocol<ObliviousChoiceKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, ObliviousChoiceProtocol, TernaryKernelProtocol<ObliviousChoiceKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, ObliviousChoiceProtocol, TernaryKernelProtocol<ObliviousChoiceKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, ObliviousChoiceProtocol, TernaryKernelProtocol<ObliviousChoiceKernel>)
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_CHOICE_H */
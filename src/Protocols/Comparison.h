@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_COMPARISON_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_COMPARISON_H
+
+#include <sharemind/libemulator_protocols/Binary.h>
+#include "../Kernels/Comparison.h"
+#include "../ValueTraits.h"
+#include "KernelProtocol.h"
+
+
+namespace sharemind {
+
+#define SPDZ_FRESCO_EMU_COMPARISON_KERNEL(Kernel,name) \
+    struct SHAREMIND_VISIBILITY_INTERNAL Kernel { \
+        template <typename S, typename B, typename R> \
+        static inline void invoke(const S * a, B b, R * result, \
+                                  std::size_t size) noexcept \
+        { kernels::name(a, b, result, size); } \
+    };
+
+SPDZ_FRESCO_EMU_COMPARISON_KERNEL(EqualityKernel, eq)
+SPDZ_FRESCO_EMU_COMPARISON_KERNEL(GreaterThanKernel, gt)
+SPDZ_FRESCO_EMU_COMPARISON_KERNEL(GreaterThanOrEqualKernel, gte)
+SPDZ_FRESCO_EMU_COMPARISON_KERNEL(LessThanKernel, lt)
+SPDZ_FRESCO_EMU_COMPARISON_KERNEL(LessThanOrEqualKernel, lte)
+
+#undef SPDZ_FRESCO_EMU_COMPARISON_KERNEL
+
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_bool_t, EqualityProtocol, BinaryKernelProtocol<EqualityKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, EqualityProtocol, BinaryKernelProtocol<EqualityKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, EqualityProtocol, BinaryKernelProtocol<EqualityKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, EqualityProtocol, BinaryKernelProtocol<EqualityKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, EqualityProtocol, BinaryKernelProtocol<EqualityKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, GreaterThanProtocol, BinaryKernelProtocol<GreaterThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, GreaterThanProtocol, BinaryKernelProtocol<GreaterThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, GreaterThanProtocol, BinaryKernelProtocol<GreaterThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, GreaterThanProtocol, BinaryKernelProtocol<GreaterThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, GreaterThanOrEqualProtocol, BinaryKernelProtocol<GreaterThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, GreaterThanOrEqualProtocol, BinaryKernelProtocol<GreaterThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, GreaterThanOrEqualProtocol, BinaryKernelProtocol<GreaterThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, GreaterThanOrEqualProtocol, BinaryKernelProtocol<GreaterThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, LessThanProtocol, BinaryKernelProtocol<LessThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, LessThanProtocol, BinaryKernelProtocol<LessThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, LessThanProtocol, BinaryKernelProtocol<LessThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, LessThanProtocol, BinaryKernelProtocol<LessThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, LessThanOrEqualProtocol, BinaryKernelProtocol<LessThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, LessThanOrEqualProtocol, BinaryKernelProtocol<LessThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, LessThanOrEqualProtocol, BinaryKernelProtocol<LessThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, LessThanOrEqualProtocol, BinaryKernelProtocol<LessThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, EqualityProtocol, BinaryKernelProtocol<EqualityKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, EqualityProtocol, BinaryKernelProtocol<EqualityKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, GreaterThanProtocol, BinaryKernelProtocol<GreaterThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, GreaterThanProtocol, BinaryKernelProtocol<GreaterThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, GreaterThanOrEqualProtocol, BinaryKernelProtocol<GreaterThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, GreaterThanOrEqualProtocol, BinaryKernelProtocol<GreaterThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, LessThanProtocol, BinaryKernelProtocol<LessThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, LessThanProtocol, BinaryKernelProtocol<LessThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, LessThanOrEqualProtocol, BinaryKernelProtocol<LessThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, LessThanOrEqualProtocol, BinaryKernelProtocol<LessThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, EqualityProtocol, BinaryKernelProtocol<EqualityKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, GreaterThanProtocol, BinaryKernelProtocol<GreaterThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, GreaterThanOrEqualProtocol, BinaryKernelProtocol<GreaterThanOrEqualKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, LessThanProtocol, BinaryKernelProtocol<LessThanKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, LessThanOrEqualProtocol, BinaryKernelProtocol<LessThanOrEqualKernel>)
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_COMPARISON_H */
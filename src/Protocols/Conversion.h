@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_CONVERSION_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_CONVERSION_H
+
+#include <sharemind/libemulator_protocols/Unary.h>
+#include "../ValueTraits.h"
+#include "KernelProtocol.h"
+
+
+namespace sharemind {
+
+struct SHAREMIND_VISIBILITY_INTERNAL ConversionKernel {
+    template <typename S, typename R>
+    static inline void invoke(const S * a, R * result, std::size_t size)
+            noexcept
+    {
+        for (std::size_t i = 0u; i < size; ++i)
+            result[i] = static_cast<R>(a[i]);
+    }
+};
+
+/** Converts nonzero values to true and zero to false. */
+struct SHAREMIND_VISIBILITY_INTERNAL BoolConversionKernel {
+    template <typename S>
+    static inline void invoke(const S * a, uint8_t * result,
+                              std::size_t size) noexcept
+    {
+        for (std::size_t i = 0u; i < size; ++i)
+            result[i] = a[i] != 0u;
+    }
+};
+
+/**
+ * Converts to booleans. The conversions to integers can not be used, since
+ * they would truncate the values instead. There is no corresponding protocol
+ * in libemulator_protocols, the template parameter is only there to match the
+ * syscall definitions of the other protocols.
+ */
+template <typename PDPI>
+using BoolConversionProtocol = UnaryKernelProtocol<BoolConversionKernel>;
+
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_bool_t, ConversionProtocol, UnaryKernelProtocol<ConversionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint8_t, ConversionProtocol, UnaryKernelProtocol<ConversionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint16_t, ConversionProtocol, UnaryKernelProtocol<ConversionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint32_t, ConversionProtocol, UnaryKernelProtocol<ConversionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_uint64_t, ConversionProtocol, UnaryKernelProtocol<ConversionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int32_t, ConversionProtocol, UnaryKernelProtocol<ConversionKernel>)
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_int64_t, ConversionProtocol, UnaryKernelProtocol<ConversionKernel>)
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_CONVERSION_H */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_FIXEDPOINT_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_FIXEDPOINT_H
+
+#include <sharemind/libemulator_protocols/Binary.h>
+#include "../Kernels/FixedPoint.h"
+#include "../ValueTraits.h"
+#include "KernelProtocol.h"
+
+
+namespace sharemind {
+
+/**
+ * Base of the fixed-point kernels, which take the number of fractional bits
+ * from the configuration of the protection domain.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL FixedPointKernel {
+
+public: /* Methods: */
+
+    inline FixedPointKernel(SpdzFrescoPDPI & pdpi) noexcept
+        : m_fractionalBits(pdpi.pdConfiguration().fixedPointFractionalBits())
+    {}
+
+protected: /* Fields: */
+
+    unsigned m_fractionalBits;
+
+}; /* class FixedPointKernel { */
+
+struct SHAREMIND_VISIBILITY_INTERNAL FixedMultiplicationKernel
+    : FixedPointKernel
+{
+    using FixedPointKernel::FixedPointKernel;
+    template <typename B>
+    inline void invoke(const int64_t * a, B b, int64_t * result,
+                       std::size_t size) const noexcept
+    { kernels::fixMul(a, b, result, size, m_fractionalBits); }
+};
+
+/** Private divisors of zero give zero, public ones are rejected. */
+struct SHAREMIND_VISIBILITY_INTERNAL FixedDivisionKernel : FixedPointKernel {
+    using FixedPointKernel::FixedPointKernel;
+    template <typename B>
+    inline void invoke(const int64_t * a, B b, int64_t * result,
+                       std::size_t size) const noexcept
+    { kernels::fixDiv(a, b, result, size, m_fractionalBits); }
+    static inline bool isValidPublic(int64_t b) noexcept { return b != 0; }
+};
+
+#define SPDZ_FRESCO_EMU_FIXED_POINT_UNARY_KERNEL(Kernel,name) \
+    struct SHAREMIND_VISIBILITY_INTERNAL Kernel : FixedPointKernel { \
+        using FixedPointKernel::FixedPointKernel; \
+        inline void invoke(const int64_t * a, int64_t * result, \
+                           std::size_t size) const noexcept \
+        { kernels::name(a, result, size, m_fractionalBits); } \
+    };
+
+SPDZ_FRESCO_EMU_FIXED_POINT_UNARY_KERNEL(FixedSqrtKernel, fixSqrt)
+SPDZ_FRESCO_EMU_FIXED_POINT_UNARY_KERNEL(IntToFixedKernel, intToFix)
+SPDZ_FRESCO_EMU_FIXED_POINT_UNARY_KERNEL(FixedToIntKernel, fixToInt)
+
+#undef SPDZ_FRESCO_EMU_FIXED_POINT_UNARY_KERNEL
+
+/*
+ * There are no corresponding protocols in libemulator_protocols, the
+ * template parameters are only there to match the syscall definitions of the
+ * other protocols.
+ */
+template <typename PDPI>
+using FixedDivisionProtocol = CheckedBinaryKernelProtocol<FixedDivisionKernel>;
+template <typename PDPI>
+using FixedSqrtProtocol = UnaryKernelProtocol<FixedSqrtKernel>;
+template <typename PDPI>
+using IntToFixedProtocol = UnaryKernelProtocol<IntToFixedKernel>;
+template <typename PDPI>
+using FixedToIntProtocol = UnaryKernelProtocol<FixedToIntKernel>;
+
+SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(sf_fix64_t, MultiplicationProtocol, BinaryKernelProtocol<FixedMultiplicationKernel>)
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_FIXEDPOINT_H */
@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_KERNELPROTOCOL_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_KERNELPROTOCOL_H
+
+#include <sharemind/ShareVector.h>
+#include <sharemind/visibility.h>
+#include <sharemind/VmVector.h>
+#include <type_traits>
+#include "../SpdzFrescoPDPI.h"
+#include "../WorkerPool.h"
+
+
+namespace sharemind {
+
+/**
+ * Selects the protocol a meta-syscall runs for the given share type and
+ * libemulator_protocols protocol. Specializations route the operation to a
+ * module-local kernel protocol. Kernels must allow the result array to be the
+ * same as an operand array, since syscalls may operate in place.
+ */
+template <typename T, typename Protocol>
+struct SHAREMIND_VISIBILITY_INTERNAL KernelProtocol {
+    using type = Protocol;
+};
+
+#define SPDZ_FRESCO_EMU_KERNEL_PROTOCOL(T,Protocol,...) \
+    template <> \
+    struct SHAREMIND_VISIBILITY_INTERNAL \
+            KernelProtocol<T, Protocol<SpdzFrescoPDPI> > \
+    { using type = __VA_ARGS__; };
+
+/**
+ * Constructs the kernel of a kernel protocol. Kernels which depend on the
+ * configuration of the protection domain are constructed from the PDPI,
+ * stateless kernels are default constructed.
+ */
+template <typename Kernel>
+inline typename std::enable_if<
+        std::is_constructible<Kernel, SpdzFrescoPDPI &>::value,
+        Kernel>::type
+makeKernel(SpdzFrescoPDPI & pdpi) noexcept
+{ return Kernel(pdpi); }
+
+template <typename Kernel>
+inline typename std::enable_if<
+        !std::is_constructible<Kernel, SpdzFrescoPDPI &>::value,
+        Kernel>::type
+makeKernel(SpdzFrescoPDPI &) noexcept
+{ return Kernel(); }
+
+/**
+ * Elementwise unary protocol over contiguous share arrays. Kernel provides
+ * an invoke(a, result, size) function. Large inputs are split across the
+ * worker pool of the protection domain.
+ */
+template <typename Kernel>
+class SHAREMIND_VISIBILITY_INTERNAL UnaryKernelProtocol {
+
+public: /* Methods: */
+
+    inline UnaryKernelProtocol(SpdzFrescoPDPI & pdpi) noexcept
+        : m_workerPool(pdpi.workerPool())
+        , m_kernel(makeKernel<Kernel>(pdpi))
+    {}
+
+    template <typename T, typename R>
+    bool invoke(const ShareVec<T> & a, ShareVec<R> & result) {
+        if (a.size() != result.size())
+            return false;
+
+        const auto * const pa = a.data();
+        auto * const pr = result.data();
+        m_workerPool.parallelFor(result.size(),
+            [this, pa, pr](std::size_t begin, std::size_t end) noexcept
+            { m_kernel.invoke(pa + begin, pr + begin, end - begin); });
+        return true;
+    }
+
+private: /* Fields: */
+
+    WorkerPool & m_workerPool;
+    const Kernel m_kernel;
+
+}; /* class UnaryKernelProtocol { */
+
+/**
+ * Elementwise binary protocol over contiguous share arrays. Kernel provides
+ * an invoke(a, b, result, size) function, where b is either a pointer or a
+ * single public value. Large inputs are split across the worker pool of the
+ * protection domain.
+ */
+template <typename Kernel>
+class SHAREMIND_VISIBILITY_INTERNAL BinaryKernelProtocol {
+
+public: /* Methods: */
+
+    inline BinaryKernelProtocol(SpdzFrescoPDPI & pdpi) noexcept
+        : m_workerPool(pdpi.workerPool())
+        , m_kernel(makeKernel<Kernel>(pdpi))
+    {}
+
+    template <typename T, typename R>
+    bool invoke(const ShareVec<T> & a,
+                const ShareVec<T> & b,
+                ShareVec<R> & result)
+    {
+        if (a.size() != b.size() || a.size() != result.size())
+            return false;
+
+        const auto * const pa = a.data();
+        const auto * const pb = b.data();
+        auto * const pr = result.data();
+        m_workerPool.parallelFor(result.size(),
+            [this, pa, pb, pr](std::size_t begin, std::size_t end) noexcept {
+                m_kernel.invoke(pa + begin, pb + begin, pr + begin,
+                                end - begin);
+            });
+        return true;
+    }
+
+    /**
+     * \brief Applies the kernel with a public right-hand operand.
+     * \details A public operand of a single value is broadcast to all
+     *          elements, otherwise it must be of the same size as a.
+     */
+    template <typename T, typename R>
+    bool invoke(const ShareVec<T> & a,
+                const ImmutableVmVec<T> & b,
+                ShareVec<R> & result)
+    {
+        if (a.size() != result.size())
+            return false;
+
+        const auto * const pa = a.data();
+        auto * const pr = result.data();
+        if (b.size() == 1u && a.size() != 1u) {
+            const auto value = b[0u];
+            m_workerPool.parallelFor(result.size(),
+                [this, pa, value, pr](std::size_t begin, std::size_t end)
+                        noexcept
+                {
+                    m_kernel.invoke(pa + begin, value, pr + begin,
+                                    end - begin);
+                });
+        } else {
+            if (b.size() != a.size())
+                return false;
+            if (a.size() == 0u)
+                return true;
+
+            const auto * const pb = &b[0u];
+            m_workerPool.parallelFor(result.size(),
+                [this, pa, pb, pr](std::size_t begin, std::size_t end)
+                        noexcept
+                {
+                    m_kernel.invoke(pa + begin, pb + begin, pr + begin,
+                                    end - begin);
+                });
+        }
+        return true;
+    }
+
+private: /* Fields: */
+
+    WorkerPool & m_workerPool;
+    const Kernel m_kernel;
+
+}; /* class BinaryKernelProtocol { */
+
+/**
+ * Binary protocol, which fails for public right-hand operands the operation
+ * is not defined for. In addition to the functions of a BinaryKernelProtocol
+ * kernel, Kernel provides a static isValidPublic(b) function.
+ */
+template <typename Kernel>
+class SHAREMIND_VISIBILITY_INTERNAL CheckedBinaryKernelProtocol
+    : public BinaryKernelProtocol<Kernel>
+{
+
+public: /* Methods: */
+
+    using BinaryKernelProtocol<Kernel>::BinaryKernelProtocol;
+    using BinaryKernelProtocol<Kernel>::invoke;
+
+    template <typename T, typename R>
+    bool invoke(const ShareVec<T> & a,
+                const ImmutableVmVec<T> & b,
+                ShareVec<R> & result)
+    {
+        for (std::size_t i = 0u; i < b.size(); ++i)
+            if (!Kernel::isValidPublic(b[i]))
+                return false;
+        return BinaryKernelProtocol<Kernel>::invoke(a, b, result);
+    }
+
+}; /* class CheckedBinaryKernelProtocol { */
+
+/**
+ * Elementwise ternary protocol over contiguous share arrays. Kernel provides
+ * an invoke(a, b, c, result, size) function, where c is either a pointer or
+ * a single public value. Large inputs are split across the worker
+ * pool of the protection domain.
+ */
+template <typename Kernel>
+class SHAREMIND_VISIBILITY_INTERNAL TernaryKernelProtocol {
+
+public: /* Methods: */
+
+    inline TernaryKernelProtocol(SpdzFrescoPDPI & pdpi) noexcept
+        : m_workerPool(pdpi.workerPool())
+        , m_kernel(makeKernel<Kernel>(pdpi))
+    {}
+
+    template <typename T1, typename T2, typename T3, typename R>
+    bool invoke(const ShareVec<T1> & a,
+                const ShareVec<T2> & b,
+                const ShareVec<T3> & c,
+                ShareVec<R> & result)
+    {
+        if (a.size() != b.size()
+            || a.size() != c.size()
+            || a.size() != result.size())
+            return false;
+
+        const auto * const pa = a.data();
+        const auto * const pb = b.data();
+        const auto * const pc = c.data();
+        auto * const pr = result.data();
+        m_workerPool.parallelFor(result.size(),
+            [this, pa, pb, pc, pr](std::size_t begin, std::size_t end)
+                    noexcept
+            {
+                m_kernel.invoke(pa + begin, pb + begin, pc + begin,
+                                pr + begin, end - begin);
+            });
+        return true;
+    }
+
+    /**
+     * \brief Applies the kernel with a public third operand.
+     * \details A public operand of a single value is broadcast to all
+     *          elements, otherwise it must be of the same size as a.
+     */
+    template <typename T1, typename T2, typename T3, typename R>
+    bool invoke(const ShareVec<T1> & a,
+                const ShareVec<T2> & b,
+                const ImmutableVmVec<T3> & c,
+                ShareVec<R> & result)
+    {
+        if (a.size() != b.size() || a.size() != result.size())
+            return false;
+
+        const auto * const pa = a.data();
+        const auto * const pb = b.data();
+        auto * const pr = result.data();
+        if (c.size() == 1u && a.size() != 1u) {
+            const auto value = c[0u];
+            m_workerPool.parallelFor(result.size(),
+                [this, pa, pb, value, pr](std::size_t begin,
+                                          std::size_t end) noexcept
+                {
+                    m_kernel.invoke(pa + begin, pb + begin, value, pr + begin,
+                                    end - begin);
+                });
+        } else {
+            if (c.size() != a.size())
+                return false;
+            if (a.size() == 0u)
+                return true;
+
+            const auto * const pc = &c[0u];
+            m_workerPool.parallelFor(result.size(),
+                [this, pa, pb, pc, pr](std::size_t begin, std::size_t end)
+                        noexcept
+                {
+                    m_kernel.invoke(pa + begin, pb + begin, pc + begin,
+                                    pr + begin, end - begin);
+                });
+        }
+        return true;
+    }
+
+private: /* Fields: */
+
+    WorkerPool & m_workerPool;
+    const Kernel m_kernel;
+
+}; /* class TernaryKernelProtocol { */
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_KERNELPROTOCOL_H */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_REDUCTION_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_REDUCTION_H
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "../Kernels/Arithmetic.h"
+#include "../Kernels/Comparison.h"
+#include "../ValueTraits.h"
+#include "KernelProtocol.h"
+
+
+namespace sharemind {
+
+#define SPDZ_FRESCO_EMU_REDUCTION_KERNEL(Kernel,name,combineExpr) \
+    struct SHAREMIND_VISIBILITY_INTERNAL Kernel { \
+        template <typename S> \
+        static inline S invoke(const S * a, std::size_t size) noexcept \
+        { return kernels::name(a, size); } \
+        template <typename S> \
+        static inline S combine(S a, S b) noexcept \
+        { return combineExpr; } \
+    };
+
+SPDZ_FRESCO_EMU_REDUCTION_KERNEL(SumKernel, sum, kernels::wrappingAdd(a, b))
+SPDZ_FRESCO_EMU_REDUCTION_KERNEL(ProductKernel, product,
+                                 kernels::wrappingMul(a, b))
+SPDZ_FRESCO_EMU_REDUCTION_KERNEL(MinimumKernel, min, b < a ? b : a)
+SPDZ_FRESCO_EMU_REDUCTION_KERNEL(MaximumKernel, max, b > a ? b : a)
+
+#undef SPDZ_FRESCO_EMU_REDUCTION_KERNEL
+
+/**
+ * Reduces a vector into a single-element result vector. Large inputs are
+ * reduced in chunks on the worker pool and the partial results are combined
+ * in no particular order. Kernel provides static invoke(a, size) and
+ * combine(x, y) functions.
+ */
+template <typename Kernel>
+class SHAREMIND_VISIBILITY_INTERNAL ReductionKernelProtocol {
+
+public: /* Methods: */
+
+    inline ReductionKernelProtocol(SpdzFrescoPDPI & pdpi) noexcept
+        : m_workerPool(pdpi.workerPool())
+    {}
+
+    template <typename T>
+    bool invoke(const ShareVec<T> & a, ShareVec<T> & result) {
+        using S = typename T::share_type;
+
+        if (result.size() != 1u)
+            return false;
+
+        // The reduction of an empty range is the identity element:
+        const S * const pa = a.data();
+        S total = Kernel::invoke(pa, 0u);
+        std::mutex mutex;
+        m_workerPool.parallelFor(a.size(),
+            [pa, &total, &mutex](std::size_t begin, std::size_t end) {
+                const S partial = Kernel::invoke(pa + begin, end - begin);
+                std::lock_guard<std::mutex> const guard(mutex);
+                total = Kernel::combine(total, partial);
+            });
+        result[0u] = total;
+        return true;
+    }
+
+private: /* Fields: */
+
+    WorkerPool & m_workerPool;
+
+}; /* class ReductionKernelProtocol { */
+
+/**
+ * Computes inclusive prefix sums. Large inputs are processed in two passes
+ * on the worker pool: first every chunk is scanned separately, then the
+ * totals of the preceding chunks are added to all but the first chunk.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL PrefixSumKernelProtocol {
+
+public: /* Methods: */
+
+    inline PrefixSumKernelProtocol(SpdzFrescoPDPI & pdpi) noexcept
+        : m_workerPool(pdpi.workerPool())
+    {}
+
+    template <typename T>
+    bool invoke(const ShareVec<T> & a, ShareVec<T> & result) {
+        using S = typename T::share_type;
+
+        if (a.size() != result.size())
+            return false;
+
+        struct Chunk { std::size_t begin; std::size_t end; S offset; };
+        std::vector<Chunk> chunks;
+        std::mutex mutex;
+
+        const S * const pa = a.data();
+        S * const pr = result.data();
+        m_workerPool.parallelFor(a.size(),
+            [pa, pr, &chunks, &mutex](std::size_t begin, std::size_t end) {
+                kernels::prefixSum(pa + begin, pr + begin, end - begin);
+                std::lock_guard<std::mutex> const guard(mutex);
+                chunks.push_back(Chunk{begin, end, S(0u)});
+            });
+        if (chunks.size() <= 1u)
+            return true;
+
+        std::sort(chunks.begin(), chunks.end(),
+                  [](const Chunk & x, const Chunk & y)
+                  { return x.begin < y.begin; });
+        S offset = 0u;
+        for (Chunk & chunk : chunks) {
+            chunk.offset = offset;
+            offset = kernels::wrappingAdd(offset, pr[chunk.end - 1u]);
+        }
+
+        // The chunks of the second pass need not match the first one:
+        const Chunk * const firstChunk = chunks.data();
+        const Chunk * const lastChunk = chunks.data() + chunks.size();
+        m_workerPool.parallelFor(a.size(),
+            [pr, firstChunk, lastChunk](std::size_t begin, std::size_t end) {
+                for (const Chunk * chunk = firstChunk;
+                     chunk != lastChunk;
+                     ++chunk)
+                {
+                    const std::size_t from = std::max(begin, chunk->begin);
+                    const std::size_t to = std::min(end, chunk->end);
+                    if (from < to && chunk->offset != S(0u))
+                        kernels::add(pr + from, chunk->offset, pr + from,
+                                     to - from);
+                }
+            });
+        return true;
+    }
+
+private: /* Fields: */
+
+    WorkerPool & m_workerPool;
+
+}; /* class PrefixSumKernelProtocol { */
+
+/*
+ * There are no corresponding protocols in libemulator_protocols, the
+ * template parameters are only there to match the syscall definitions of the
+ * other protocols.
+ */
+template <typename PDPI>
+using SumProtocol = ReductionKernelProtocol<SumKernel>;
+template <typename PDPI>
+using ProductProtocol = ReductionKernelProtocol<ProductKernel>;
+template <typename PDPI>
+using MinimumProtocol = ReductionKernelProtocol<MinimumKernel>;
+template <typename PDPI>
+using MaximumProtocol = ReductionKernelProtocol<MaximumKernel>;
+template <typename PDPI>
+using PrefixSumProtocol = PrefixSumKernelProtocol;
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_REDUCTION_H */
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_PROTOCOLS_SORT_H
+#define MOD_SPDZ_FRESCO_EMU_PROTOCOLS_SORT_H
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "../Kernels/Sort.h"
+#include "../ValueTraits.h"
+#include "KernelProtocol.h"
+
+
+namespace sharemind {
+
+/**
+ * Sorts a vector in ascending order with a plaintext radix sort, instead of
+ * emulating the comparisons of a sorting network.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL SortKernelProtocol {
+
+public: /* Methods: */
+
+    inline SortKernelProtocol(SpdzFrescoPDPI &) noexcept {}
+
+    template <typename T>
+    bool invoke(const ShareVec<T> & a, ShareVec<T> & result) {
+        using S = typename T::share_type;
+
+        if (a.size() != result.size())
+            return false;
+
+        std::vector<S> scratch(a.size());
+        if (&a != &result)
+            std::copy(a.begin(), a.end(), result.begin());
+        kernels::sort(result.data(), scratch.data(), result.size());
+        return true;
+    }
+
+}; /* class SortKernelProtocol { */
+
+/**
+ * Orders the values by their keys in ascending order, values with equal keys
+ * keep their order.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL SortByKeyKernelProtocol {
+
+public: /* Methods: */
+
+    inline SortByKeyKernelProtocol(SpdzFrescoPDPI &) noexcept {}
+
+    template <typename T>
+    bool invoke(const ShareVec<T> & keys,
+                const ShareVec<T> & values,
+                ShareVec<T> & result)
+    {
+        using S = typename T::share_type;
+
+        if (keys.size() != values.size() || keys.size() != result.size())
+            return false;
+
+        // The keys are copied first, since the result may be the keys:
+        std::vector<S> sortedKeys(keys.begin(), keys.end());
+        std::vector<S> scratch(2u * keys.size());
+        if (&values != &result)
+            std::copy(values.begin(), values.end(), result.begin());
+        kernels::sortByKey(sortedKeys.data(), result.data(), scratch.data(),
+                           scratch.data() + keys.size(), keys.size());
+        return true;
+    }
+
+}; /* class SortByKeyKernelProtocol { */
+
+/**
+ * Permutes a vector uniformly at random using the random engine of the
+ * protection domain instance.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL ShuffleKernelProtocol {
+
+public: /* Methods: */
+
+    inline ShuffleKernelProtocol(SpdzFrescoPDPI & pdpi) noexcept
+        : m_randomEngine(pdpi.randomEngine())
+    {}
+
+    template <typename T>
+    bool invoke(const ShareVec<T> & a, ShareVec<T> & result) {
+        if (a.size() != result.size())
+            return false;
+
+        if (&a != &result)
+            std::copy(a.begin(), a.end(), result.begin());
+        std::shuffle(result.begin(), result.end(), m_randomEngine);
+        return true;
+    }
+
+private: /* Fields: */
+
+    std::mt19937_64 & m_randomEngine;
+
+}; /* class ShuffleKernelProtocol { */
+
+/*
+ * There are no corresponding protocols in libemulator_protocols, the
+ * template parameters are only there to match the syscall definitions of the
+ * other protocols.
+ */
+template <typename PDPI>
+using SortProtocol = SortKernelProtocol;
+template <typename PDPI>
+using SortByKeyProtocol = SortByKeyKernelProtocol;
+template <typename PDPI>
+using ShuffleProtocol = ShuffleKernelProtocol;
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_PROTOCOLS_SORT_H */
@@ -29,6 +29,20 @@ SpdzFrescoConfiguration::SpdzFrescoConfiguration(const std::string & pdConf)
     : Configuration(pdConf)
     , m_modelEvaluatorConfiguration(
             get<std::string>("ProtectionDomain.ModelEvaluatorConfiguration"))
+    , m_deferredProfiling(get<bool>("Profiling.DeferredEvaluation", false))
+    , m_deferredProfilingBufferSize(
+            get<std::size_t>("Profiling.DeferredBufferSize", 4096u))
+    , m_vectorPoolMaxVectorSize(
+            get<std::size_t>("VectorPool.MaxVectorSize", 65536u))
+    , m_vectorPoolMaxBytes(
+            get<std::size_t>("VectorPool.MaxBytes", 64u * 1024u * 1024u))
+    , m_workerThreads(get<std::size_t>("WorkerPool.NumThreads", 1u))
+    , m_workerMinChunkSize(
+            get<std::size_t>("WorkerPool.MinChunkSize", 65536u))
+    , m_inputDirectory(get<std::string>("DataFiles.InputDirectory", ""))
+    , m_outputDirectory(get<std::string>("DataFiles.OutputDirectory", ""))
+    , m_fixedPointFractionalBits(
+            get<unsigned>("FixedPoint.FractionalBits", 16u))
 {}
 
 } /* namespace sharemind { */
@@ -20,6 +20,7 @@
 #ifndef MOD_SPDZ_FRESCO_EMU_SHARED3PCONFIGURATION_H
 #define MOD_SPDZ_FRESCO_EMU_SHARED3PCONFIGURATION_H
 
+#include <cstddef>
 #include <string>
 #include <sharemind/libconfiguration/Configuration.h>
 #include <sharemind/visibility.h>
@@ -40,8 +41,44 @@ public: /* Methods: */
     const std::string & modelEvaluatorConfiguration() const noexcept
     { return m_modelEvaluatorConfiguration; }
 
+    bool deferredProfiling() const noexcept
+    { return m_deferredProfiling; }
+
+    std::size_t deferredProfilingBufferSize() const noexcept
+    { return m_deferredProfilingBufferSize; }
+
+    std::size_t vectorPoolMaxVectorSize() const noexcept
+    { return m_vectorPoolMaxVectorSize; }
+
+    std::size_t vectorPoolMaxBytes() const noexcept
+    { return m_vectorPoolMaxBytes; }
+
+    std::size_t workerThreads() const noexcept
+    { return m_workerThreads; }
+
+    std::size_t workerMinChunkSize() const noexcept
+    { return m_workerMinChunkSize; }
+
+    const std::string & inputDirectory() const noexcept
+    { return m_inputDirectory; }
+
+    const std::string & outputDirectory() const noexcept
+    { return m_outputDirectory; }
+
+    unsigned fixedPointFractionalBits() const noexcept
+    { return m_fixedPointFractionalBits; }
+
 private: /* Fields: */
     std::string m_modelEvaluatorConfiguration;
+    bool m_deferredProfiling;
+    std::size_t m_deferredProfilingBufferSize;
+    std::size_t m_vectorPoolMaxVectorSize;
+    std::size_t m_vectorPoolMaxBytes;
+    std::size_t m_workerThreads;
+    std::size_t m_workerMinChunkSize;
+    std::string m_inputDirectory;
+    std::string m_outputDirectory;
+    unsigned m_fixedPointFractionalBits;
 
 }; /* class SpdzFrescoConfiguration { */
 
@@ -17,6 +17,7 @@
  * For further information, please contact us at sharemind@cyber.ee.
  */
 
+#include <LogHard/Logger.h>
 #include <sharemind/ExecutionModelEvaluator.h>
 #include "SpdzFrescoModule.h"
 #include "SpdzFrescoPD.h"
@@ -37,7 +38,8 @@ SpdzFrescoPD::SpdzFrescoPD(const std::string & pdName,
                        const std::string & pdConfiguration,
                        SpdzFrescoModule & module)
 try
-    : m_configuration(pdConfiguration)
+    : m_logger(module.logger())
+    , m_configuration(pdConfiguration)
     , m_name(pdName)
 {
     try {
@@ -47,10 +49,38 @@ try
     } catch (const ExecutionModelEvaluator::ConfigurationException &) {
         throw ConfigurationException();
     }
+
+    for (std::size_t i = 0u; i < NUM_SYSCALLS; ++i) {
+        ExecutionModelEvaluator::Model * const model =
+            m_modelEvaluator->model("TimeModel",
+                                    syscallName(static_cast<SyscallId>(i)));
+        if (model)
+            m_timeModels[i].reset(new CachedModel(*model));
+    }
+
+    if (m_configuration.fixedPointFractionalBits() > 62u)
+        throw ConfigurationException();
+
+    m_workerPool.reset(
+            new WorkerPool(m_configuration.workerThreads(),
+                           m_configuration.workerMinChunkSize()));
 } catch (const Configuration::Exception &) {
     std::throw_with_nested(ConfigurationException());
 }
 
 SpdzFrescoPD::~SpdzFrescoPD() noexcept = default;
 
+void SpdzFrescoPD::logTimeModelStatistics() const {
+    for (std::size_t i = 0u; i < NUM_SYSCALLS; ++i) {
+        const CachedModel * const model = m_timeModels[i].get();
+        if (!model || (model->hits() == 0u && model->misses() == 0u))
+            continue;
+
+        m_logger.debug() << "Time model cache of '"
+            << syscallName(static_cast<SyscallId>(i)) << "' in protection "
+            "domain '" << m_name << "': " << model->hits() << " hits, "
+            << model->misses() << " misses.";
+    }
+}
+
 } /* namespace sharemind { */
@@ -20,16 +20,21 @@
 #ifndef MOD_SPDZ_FRESCO_EMU_SHARED3PPD_H
 #define MOD_SPDZ_FRESCO_EMU_SHARED3PPD_H
 
+#include <array>
 #include <memory>
 #include <sharemind/Exception.h>
 #include <sharemind/ExceptionMacros.h>
 #include <sharemind/visibility.h>
+#include "CachedModel.h"
 #include "SpdzFrescoConfiguration.h"
+#include "Syscalls/SyscallIds.h"
+#include "WorkerPool.h"
 
 
+namespace LogHard { class Logger; }
+
 namespace sharemind {
 
-class ExecutionModelEvaluator;
 class SpdzFrescoModule;
 
 class SHAREMIND_VISIBILITY_INTERNAL SpdzFrescoPD {
@@ -62,12 +67,26 @@ public: /* Methods: */
     inline const std::string & name() const noexcept
     { return m_name; }
 
+    /**
+     * \returns the memoized time model of the syscall or nullptr if the
+     *          syscall has no time model.
+     */
+    inline CachedModel * timeModel(SyscallId id) const noexcept
+    { return m_timeModels[static_cast<std::size_t>(id)].get(); }
+
+    void logTimeModelStatistics() const;
+
+    inline WorkerPool & workerPool() noexcept { return *m_workerPool; }
+
 private: /* Fields: */
 
+    const LogHard::Logger & m_logger;
     SpdzFrescoConfiguration m_configuration;
     std::string m_name;
 
     std::unique_ptr<ExecutionModelEvaluator> m_modelEvaluator;
+    std::array<std::unique_ptr<CachedModel>, NUM_SYSCALLS> m_timeModels;
+    std::unique_ptr<WorkerPool> m_workerPool;
 
 }; /* class SpdzFrescoPD { */
 
@@ -17,6 +17,7 @@
  * For further information, please contact us at sharemind@cyber.ee.
  */
 
+#include <random>
 #include <sharemind/ExecutionModelEvaluator.h>
 #include "SpdzFrescoPDPI.h"
 
@@ -27,6 +28,20 @@ SpdzFrescoPDPI::SpdzFrescoPDPI(SpdzFrescoPD & pd)
     : m_pd(pd)
     , m_pdConfiguration(pd.configuration())
     , m_modelEvaluator(pd.modelEvaluator())
-{}
+    , m_vectorPool(m_pdConfiguration.vectorPoolMaxVectorSize(),
+                   m_pdConfiguration.vectorPoolMaxBytes())
+    , m_profilingContext(pd)
+{
+    std::random_device randomDevice;
+    std::seed_seq seed{randomDevice(), randomDevice(), randomDevice(),
+                       randomDevice()};
+    m_randomEngine.seed(seed);
+}
+
+SpdzFrescoPDPI::~SpdzFrescoPDPI() noexcept {
+    m_vectors.forEach([this](const void * vec, uint8_t heapTypeId) {
+        m_vectorPool.destroy(heapTypeId, const_cast<void *>(vec));
+    });
+}
 
 } /* namespace sharemind { */
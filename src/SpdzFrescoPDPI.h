@@ -20,10 +20,16 @@
 #ifndef MOD_SPDZ_FRESCO_EMU_SHARED3PPDPI_H
 #define MOD_SPDZ_FRESCO_EMU_SHARED3PPDPI_H
 
+#include <algorithm>
+#include <cstring>
+#include <random>
 #include <sharemind/ShareVector.h>
-#include <sharemind/SharedValueHeap.h>
 #include <sharemind/visibility.h>
+#include "HandleTable.h"
+#include "LazyVectors.h"
+#include "ProfilingContext.h"
 #include "SpdzFrescoPD.h"
+#include "VectorPool.h"
 
 namespace sharemind {
 
@@ -32,10 +38,15 @@ class SpdzFrescoConfiguration;
 
 class SHAREMIND_VISIBILITY_INTERNAL SpdzFrescoPDPI {
 
+private: /* Types: */
+
+    /** Smaller vectors are assigned and filled eagerly. */
+    static constexpr std::size_t LAZY_MIN_BYTES = 4096u;
+
 public: /* Methods: */
 
     SpdzFrescoPDPI(SpdzFrescoPD & pd);
-    inline ~SpdzFrescoPDPI() noexcept {}
+    ~SpdzFrescoPDPI() noexcept;
 
     inline const std::string & pdName() const noexcept
     { return m_pd.name(); }
@@ -49,19 +60,207 @@ public: /* Methods: */
     inline const ExecutionModelEvaluator & modelEvaluator() const noexcept
     { return m_modelEvaluator; }
 
+    inline ProfilingContext & profilingContext() noexcept
+    { return m_profilingContext; }
+
+    inline const VectorPool & vectorPool() const noexcept
+    { return m_vectorPool; }
+
+    inline WorkerPool & workerPool() noexcept
+    { return m_pd.workerPool(); }
+
+    /** \returns the randomness source of shuffles. */
+    inline std::mt19937_64 & randomEngine() noexcept
+    { return m_randomEngine; }
+
     template <typename T>
     inline bool isValidHandle(void * hndl) const {
-        return m_heap.check<T>(hndl);
+        return m_vectors.contains(hndl, T::heap_type_id);
     }
 
     template <typename T>
-    inline bool registerVector(ShareVec<T> * vec) {
-        return m_heap.insert(vec);
+    inline ShareVec<T> * newRegisteredVector(std::size_t size) {
+        ShareVec<T> * const vec = m_vectorPool.acquire<T>(size);
+        try {
+            m_vectors.insert(vec, T::heap_type_id);
+        } catch (...) {
+            m_vectorPool.release(vec);
+            throw;
+        }
+        return vec;
     }
 
     template <typename T>
     inline bool freeRegisteredVector(ShareVec<T> * vec) {
-        return m_heap.erase(vec);
+        if (!m_vectors.contains(vec, T::heap_type_id))
+            return false;
+        if (!m_lazyVectors.empty()) {
+            materializeCopiesOf(*vec);
+            m_lazyVectors.erase(vec);
+        }
+        m_vectors.erase(vec);
+        m_vectorPool.release(vec);
+        return true;
+    }
+
+    /**
+     * \brief Resizes a registered vector, keeping its handle.
+     * \pre The vector is materialized, see outputVector().
+     */
+    template <typename T>
+    inline void resizeRegisteredVector(ShareVec<T> & vec, std::size_t size)
+    { m_vectorPool.resize(vec, size); }
+
+    /**
+     * \brief Reserves capacity for a registered vector to grow into.
+     * \pre The vector is materialized, see outputVector().
+     */
+    template <typename T>
+    inline void reserveRegisteredVector(ShareVec<T> & vec,
+                                        std::size_t capacity)
+    { m_vectorPool.reserve(vec, capacity); }
+
+    /*
+     * Vectors assigned with assignLazily() and fillLazily() are written only
+     * when they or their sources are accessed through outputVector(), so
+     * syscalls must access all vectors through inputVector() and
+     * outputVector(). Resolve the output vectors of a syscall before its
+     * inputs, since materializing an output may change where the inputs are
+     * read from.
+     */
+
+    /**
+     * \returns the vector to read the contents of the handle from, or
+     *          nullptr if the handle is not a vector of type T. This is the
+     *          source vector for lazy copies.
+     */
+    template <typename T>
+    inline const ShareVec<T> * inputVector(void * hndl) {
+        if (!isValidHandle<T>(hndl))
+            return nullptr;
+
+        ShareVec<T> * const vec = static_cast<ShareVec<T> *>(hndl);
+        if (m_lazyVectors.empty())
+            return vec;
+
+        const LazyVectors::State * const state = m_lazyVectors.find(vec);
+        if (!state)
+            return vec;
+        if (state->source)
+            return static_cast<const ShareVec<T> *>(state->source);
+
+        materialize(*vec, *state);
+        m_lazyVectors.erase(vec);
+        return vec;
+    }
+
+    /**
+     * \returns the materialized vector of the handle for writing and
+     *          possibly reading, or nullptr if the handle is not a vector of
+     *          type T.
+     */
+    template <typename T>
+    inline ShareVec<T> * outputVector(void * hndl) {
+        if (!isValidHandle<T>(hndl))
+            return nullptr;
+
+        ShareVec<T> * const vec = static_cast<ShareVec<T> *>(hndl);
+        if (m_lazyVectors.empty())
+            return vec;
+
+        materializeCopiesOf(*vec);
+        if (const LazyVectors::State * const state = m_lazyVectors.find(vec))
+        {
+            materialize(*vec, *state);
+            m_lazyVectors.erase(vec);
+        }
+        return vec;
+    }
+
+    /**
+     * \brief Makes dest a copy of src without copying large vectors until
+     *        either of them is written to.
+     * \pre Both are valid vectors of the same size.
+     */
+    template <typename T>
+    void assignLazily(ShareVec<T> & dest, ShareVec<T> & src) {
+        if (&dest == &src)
+            return;
+
+        if (!m_lazyVectors.empty())
+            materializeCopiesOf(dest);
+
+        const LazyVectors::State * const state = m_lazyVectors.empty()
+                                                 ? nullptr
+                                                 : m_lazyVectors.find(&src);
+        if (dest.size() * sizeof(typename T::share_type) < LAZY_MIN_BYTES) {
+            const ShareVec<T> & from = (state && state->source)
+                ? *static_cast<const ShareVec<T> *>(state->source)
+                : src;
+            if (state && !state->source) {
+                std::fill(dest.begin(), dest.end(),
+                          static_cast<typename T::share_type>(state->value));
+            } else if (!dest.empty()) {
+                std::memcpy(dest.data(), from.data(),
+                            dest.size() * sizeof(typename T::share_type));
+            }
+            m_lazyVectors.erase(&dest);
+        } else if (!state) {
+            m_lazyVectors.setCopy(&dest, &src);
+        } else if (state->source) {
+            m_lazyVectors.setCopy(&dest, state->source);
+        } else {
+            m_lazyVectors.setBroadcast(&dest, state->value);
+        }
+    }
+
+    /**
+     * \brief Sets all elements of vec to value without writing large vectors
+     *        until they are accessed.
+     * \pre vec is a valid vector.
+     */
+    template <typename T>
+    void fillLazily(ShareVec<T> & vec, typename T::share_type value) {
+        if (!m_lazyVectors.empty())
+            materializeCopiesOf(vec);
+
+        if (vec.size() * sizeof(typename T::share_type) < LAZY_MIN_BYTES) {
+            std::fill(vec.begin(), vec.end(), value);
+            m_lazyVectors.erase(&vec);
+        } else {
+            m_lazyVectors.setBroadcast(&vec, static_cast<uint64_t>(value));
+        }
+    }
+
+private:
+
+    template <typename T>
+    inline void materialize(ShareVec<T> & vec, const LazyVectors::State & state)
+            noexcept
+    {
+        using share_type = typename T::share_type;
+        if (state.source) {
+            const ShareVec<T> & source =
+                *static_cast<const ShareVec<T> *>(state.source);
+            if (!vec.empty())
+                std::memcpy(vec.data(), source.data(),
+                            vec.size() * sizeof(share_type));
+        } else {
+            std::fill(vec.begin(), vec.end(),
+                      static_cast<share_type>(state.value));
+        }
+    }
+
+    template <typename T>
+    inline void materializeCopiesOf(const ShareVec<T> & source) {
+        using share_type = typename T::share_type;
+        for (const void * copy : m_lazyVectors.releaseCopies(&source)) {
+            ShareVec<T> & vec =
+                *static_cast<ShareVec<T> *>(const_cast<void *>(copy));
+            if (!vec.empty())
+                std::memcpy(vec.data(), source.data(),
+                            vec.size() * sizeof(share_type));
+        }
     }
 
 private: /* Fields: */
@@ -69,7 +268,11 @@ private: /* Fields: */
     SpdzFrescoPD & m_pd;
     SpdzFrescoConfiguration & m_pdConfiguration;
     ExecutionModelEvaluator & m_modelEvaluator;
-    SharedValueHeap m_heap;
+    VectorPool m_vectorPool;
+    HandleTable m_vectors;
+    LazyVectors m_lazyVectors;
+    ProfilingContext m_profilingContext;
+    std::mt19937_64 m_randomEngine;
 
 }; /* class SpdzFrescoPDPI { */
 
@@ -22,12 +22,11 @@
 
 #include <inttypes.h>
 #include <sharemind/Concat.h>
-#include <sharemind/ExecutionModelEvaluator.h>
-#include <sharemind/ExecutionProfiler.h>
 #include <sharemind/module-apis/api_0x1.h>
 #include <sharemind/SyscallsCommon.h>
 #include <sstream>
 #include "../ValueTraits.h"
+#include "SyscallIds.h"
 
 namespace sharemind {
 
@@ -43,19 +42,37 @@ using VMHandles = PdpiVmHandles<SPDZ_FRESCO_EMU_INDEX>;
 template <typename T>
 inline typename T::public_type getStack(const SharemindCodeBlock & arg);
 
+template <>
+inline bool getStack<sf_bool_t>(const SharemindCodeBlock & arg)
+{ return arg.uint8[0] != 0u; }
+template <>
+inline uint8_t getStack<sf_uint8_t>(const SharemindCodeBlock & arg)
+{ return arg.uint8[0]; }
+template <>
+inline uint16_t getStack<sf_uint16_t>(const SharemindCodeBlock & arg)
+{ return arg.uint16[0]; }
 template <>
 inline uint32_t getStack<sf_uint32_t>(const SharemindCodeBlock & arg)
 { return arg.uint32[0]; }
 template <>
 inline uint64_t getStack<sf_uint64_t>(const SharemindCodeBlock & arg)
 { return arg.uint64[0]; }
+template <>
+inline int32_t getStack<sf_int32_t>(const SharemindCodeBlock & arg)
+{ return arg.int32[0]; }
+template <>
+inline int64_t getStack<sf_int64_t>(const SharemindCodeBlock & arg)
+{ return arg.int64[0]; }
+template <>
+inline int64_t getStack<sf_fix64_t>(const SharemindCodeBlock & arg)
+{ return arg.int64[0]; }
 
 /**
  * Macros for defining named syscalls and their wrappers
  */
 #define NAMED_SYSCALL(fname,name,args,argc,refs,crefs,retVal,c) \
     SharemindModuleApi0x1Error fname( \
-            const char * name, \
+            SyscallId name, \
             SharemindCodeBlock * args, \
             size_t argc, \
             const SharemindModuleApi0x1Reference * refs, \
@@ -72,7 +89,7 @@ inline uint64_t getStack<sf_uint64_t>(const SharemindCodeBlock & arg)
         SharemindCodeBlock * retVal, \
         SharemindModuleApi0x1SyscallContext * c) \
     { \
-        return __VA_ARGS__(("spdz_fresco::" #name), args, argc, refs, crefs, retVal, c); \
+        return __VA_ARGS__(SyscallId::name, args, argc, refs, crefs, retVal, c); \
     }
 
 #define NAMED_SYSCALL_DEFINITION(signature,fptr) \
@@ -80,42 +97,10 @@ inline uint64_t getStack<sf_uint64_t>(const SharemindCodeBlock & arg)
 
 
 /**
- * Macros for profiling syscalls
+ * Macro for profiling syscalls
  */
-/// \todo evaluate() returns double. Make sure we can cast it to UsTime.
-#ifdef SHAREMIND_NETWORK_STATISTICS_ENABLE
-#define PROFILE_SYSCALL(ctx,evaluator,name,parameter) \
-    do { \
-        if (auto * const profiler = static_cast<ExecutionProfiler *>( \
-                ctx->processFacility(ctx, "Profiler"))) \
-        { \
-            static const uint32_t sectionTypeId = \
-                profiler->newSectionType((name)); \
-            sharemind::ExecutionModelEvaluator::Model * const timeModel = \
-                (evaluator).model("TimeModel", (name)); \
-            if (timeModel) \
-                profiler->addSection(sectionTypeId, (parameter), 0u, \
-                        timeModel->evaluate((parameter)), \
-                        sharemind::MinerNetworkStatistics(), \
-                        sharemind::MinerNetworkStatistics()); \
-        } \
-    } while (false)
-#else
-#define PROFILE_SYSCALL(ctx,evaluator,name,parameter) \
-    do { \
-        if (auto * const profiler = static_cast<ExecutionProfiler *>( \
-                ctx->processFacility(ctx, "Profiler"))) \
-        { \
-            static const uint32_t sectionTypeId = \
-                profiler->newSectionType((name)); \
-            sharemind::ExecutionModelEvaluator::Model * const timeModel = \
-                (evaluator).model("TimeModel", (name)); \
-            if (timeModel) \
-                profiler->addSection(sectionTypeId, (parameter), 0u, \
-                        timeModel->evaluate((parameter))); \
-        } \
-    } while (false)
-#endif
+#define PROFILE_SYSCALL(ctx,profilingContext,name,parameter) \
+    (profilingContext).profile((ctx), (name), (parameter))
 
 } /* namespace sharemind */
 
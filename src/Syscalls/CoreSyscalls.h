@@ -20,10 +20,14 @@
 #ifndef MOD_SPDZ_FRESCO_EMU_SYSCALLS_CORESYSCALLS_H
 #define MOD_SPDZ_FRESCO_EMU_SYSCALLS_CORESYSCALLS_H
 
+#include <cstring>
 #include <sharemind/module-apis/api_0x1.h>
 #include <sharemind/ShareVector.h>
 #include <sharemind/VmVector.h>
+#include <type_traits>
 #include "Common.h"
+#include "../DataFile.h"
+#include "../Kernels/Gather.h"
 #include "../SpdzFrescoPDPI.h"
 #include "../ValueTraits.h"
 
@@ -42,7 +46,7 @@ namespace sharemind {
  * Postcondition:
  *      Return value is set to valid handle to args[1u].uint64[0u] sized vector of type T.
  * Effect:
- *      Allocates memory for the vector.
+ *      Allocates memory for the vector or reuses a deleted vector.
  */
 template <typename T>
 NAMED_SYSCALL(new_vec, name, args, num_args, refs, crefs, returnValue, c)
@@ -63,12 +67,11 @@ NAMED_SYSCALL(new_vec, name, args, num_args, refs, crefs, returnValue, c)
         SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
         const size_t vsize = args[1u].uint64[0u];
 
-        ShareVec<T> * const vec = new ShareVec<T>(vsize);
-        pdpi->registerVector(vec);
+        ShareVec<T> * const vec = pdpi->newRegisteredVector<T>(vsize);
 
         returnValue->p[0u] = vec;
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name, vsize);
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, vsize);
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -88,6 +91,7 @@ NAMED_SYSCALL(new_vec, name, args, num_args, refs, crefs, returnValue, c)
  *      Destination vector is initialized to shares of second stack position.
  * Effect:
  *      Networks communication is performed to share the value.
+ *      Large vectors are initialized lazily, see SpdzFrescoPDPI.
  */
 template <typename T>
 NAMED_SYSCALL(init_vec, name, args, num_args, refs, crefs, returnValue, c)
@@ -105,10 +109,9 @@ NAMED_SYSCALL(init_vec, name, args, num_args, refs, crefs, returnValue, c)
 
         ShareVec<T> & vec = *static_cast<ShareVec<T>*>(args[2u].p[0u]);
         const typename T::public_type init = getStack<T>(args[1u]);
-        for (size_t i = 0u; i < vec.size(); ++i)
-            vec[i] = init;
+        pdpi->fillLazily(vec, static_cast<typename T::share_type>(init));
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
                         vec.size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
@@ -152,20 +155,17 @@ NAMED_SYSCALL(set_shares, name, args, num_args, refs, crefs, returnValue, c)
         const size_t num_elems = (crefs[0u].size - 1) / sizeof(share_type);
 
         if (num_args == 2) {
-            if (!pdpi->isValidHandle<T>(args[1u].p[0u]))
+            ShareVec<T> * const dest = pdpi->outputVector<T>(args[1u].p[0u]);
+            if (!dest || dest->size() != num_elems)
                 return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
 
-            ShareVec<T> & dest = *static_cast<ShareVec<T>*>(args[1u].p[0u]);
-            if (dest.size() != num_elems)
-                return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
-
-            dest.assign(src, src + num_elems);
+            dest->assign(src, src + num_elems);
         }
 
         if (returnValue)
             returnValue->uint64[0u] = num_elems;
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
                         num_elems);
 
         return SHAREMIND_MODULE_API_0x1_OK;
@@ -201,11 +201,12 @@ NAMED_SYSCALL(get_shares, name, args, num_args, refs, crefs, returnValue, c)
     try {
         SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
 
-        if (!pdpi->isValidHandle<T>(args[1u].p[0u]))
+        const ShareVec<T> * const srcVec = pdpi->inputVector<T>(args[1u].p[0u]);
+        if (!srcVec)
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
 
         typedef typename ValueTraits<T>::share_type share_type;
-        const ShareVec<T> & src = *static_cast<const ShareVec<T>*>(args[1u].p[0u]);
+        const ShareVec<T> & src = *srcVec;
         const size_t num_bytes = src.size() * sizeof(share_type);
 
         if (refs) {
@@ -222,7 +223,7 @@ NAMED_SYSCALL(get_shares, name, args, num_args, refs, crefs, returnValue, c)
         if (returnValue)
             returnValue->uint64[0u] = num_bytes;
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
                         src.size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
@@ -263,7 +264,7 @@ NAMED_SYSCALL(get_type_size, name, args, num_args, refs, crefs, returnValue, c)
         typedef typename ValueTraits<T>::share_type share_type;
         returnValue->uint64[0u] = sizeof(share_type);
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name, 0u);
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, 0u);
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -282,6 +283,8 @@ NAMED_SYSCALL(get_type_size, name, args, num_args, refs, crefs, returnValue, c)
  *      Argument vector is not empty.
  * Postcondition:
  *      All elements of the output vector are equal to the first element of argument vector.
+ * Effect:
+ *      Large vectors are filled lazily, see SpdzFrescoPDPI.
  */
 template <typename T>
 NAMED_SYSCALL(fill_vec, name, args, num_args, refs, crefs, returnValue, c)
@@ -297,18 +300,21 @@ NAMED_SYSCALL(fill_vec, name, args, num_args, refs, crefs, returnValue, c)
         void * const destHandle = args[2u].p[0u];
         SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
 
-        if (!pdpi->isValidHandle<T>(srcHandle) ||
-            !pdpi->isValidHandle<T>(destHandle)) {
+        if (!pdpi->isValidHandle<T>(destHandle))
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
-        }
 
         ShareVec<T> & dest = *static_cast<ShareVec<T>*>(destHandle);
-        const ShareVec<T> & src = *static_cast<ShareVec<T>*>(srcHandle);
+        const ShareVec<T> * const src = pdpi->inputVector<T>(srcHandle);
+        if (!src)
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
 
-        for (size_t i = 0; i < dest.size(); ++i)
-            dest[i] = src[0u];
+        if (!dest.empty()) {
+            if (src->empty())
+                return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+            pdpi->fillLazily(dest, (*src)[0u]);
+        }
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
                         dest.size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
@@ -330,6 +336,7 @@ NAMED_SYSCALL(fill_vec, name, args, num_args, refs, crefs, returnValue, c)
  *     Output vector contains same elements in the same order as argument vector.
  * Effect:
  *     No reclassification is performed.
+ *     Large vectors are copied lazily, see SpdzFrescoPDPI.
  */
 template <typename T>
 NAMED_SYSCALL(assign_vec, name, args, num_args, refs, crefs, returnValue, c)
@@ -351,15 +358,15 @@ NAMED_SYSCALL(assign_vec, name, args, num_args, refs, crefs, returnValue, c)
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
         }
 
-        const ShareVec<T> & src = *static_cast<ShareVec<T>*>(srcHandle);
+        ShareVec<T> & src = *static_cast<ShareVec<T>*>(srcHandle);
         ShareVec<T> & dest = *static_cast<ShareVec<T>*>(destHandle);
 
         if (src.size() != dest.size())
             return SHAREMIND_MODULE_API_0x1_INVALID_CALL;
 
-        dest.assign(src);
+        pdpi->assignLazily(dest, src);
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
                         dest.size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
@@ -392,22 +399,28 @@ NAMED_SYSCALL(declassify_vec, name, args, num_args, refs, crefs, returnValue, c)
 
     try {
         SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
-        MutableVmVec<T> dest(refs[0u]);
 
-        void * const srcHandle = args[1u].p[0u];
-        if (!pdpi->isValidHandle<T>(srcHandle)) {
+        const ShareVec<T> * const srcVec =
+            pdpi->inputVector<T>(args[1u].p[0u]);
+        if (!srcVec) {
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
         }
 
-        const ShareVec<T> & src = *static_cast<ShareVec<T>*>(srcHandle);
-        if (refs[0u].size < sizeof(T) * src.size()) {
+        // Shares are stored in the layout of the public values:
+        using share_type = typename ValueTraits<T>::share_type;
+        static_assert(sizeof(share_type) ==
+                      sizeof(typename ValueTraits<T>::public_type), "");
+
+        const ShareVec<T> & src = *srcVec;
+        const size_t num_bytes = src.size() * sizeof(share_type);
+        if (refs[0u].size < num_bytes) {
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
         }
 
-        for (size_t i = 0u; i < src.size(); ++i)
-            dest[i] = src[i];
+        if (num_bytes > 0u)
+            std::memcpy(refs[0u].pData, src.data(), num_bytes);
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
                         src.size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
@@ -441,21 +454,181 @@ NAMED_SYSCALL(classify_vec, name, args, num_args, refs, crefs, returnValue, c)
     try {
         SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
 
-        void * const destHandle = args[1u].p[0u];
-        if (!pdpi->isValidHandle<T>(destHandle)) {
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(args[1u].p[0u]);
+        if (!destVec) {
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
         }
 
-        ShareVec<T> & dest = *static_cast<ShareVec<T>*>(destHandle);
-        ImmutableVmVec<T> src(crefs[0u]);
-        if (sizeof(T) * dest.size() > crefs[0u].size) {
+        // Shares are stored in the layout of the public values:
+        using share_type = typename ValueTraits<T>::share_type;
+        static_assert(sizeof(share_type) ==
+                      sizeof(typename ValueTraits<T>::public_type), "");
+
+        ShareVec<T> & dest = *destVec;
+        const size_t num_bytes = dest.size() * sizeof(share_type);
+        if (num_bytes > crefs[0u].size) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        if (num_bytes > 0u)
+            std::memcpy(dest.data(), crefs[0u].pData, num_bytes);
+
+        // Boolean shares are kept as 0/1 bytes:
+        if (is_bool_value_tag<T>::value) {
+            for (share_type & value : dest)
+                value = (value != 0u);
+        }
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                        dest.size());
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: classify_file_vec<T>
+ * Args:
+ *     0) uint64[0u]     pd index
+ *     1) uint64[0u]     offset in the file in bytes
+ *     2) p[0u]          handle to destination vector
+ * CRefs:
+ *     0) crefs[0u]      name of the file in the input directory
+ * Precondition:
+ *     The destination handle is valid vector of type T.
+ *     The file is in the input directory given in the configuration.
+ *     The file contains the public values of the destination vector in the
+ *     native byte order, starting from the offset.
+ * Postcondition:
+ *     The destination vector contains the values read from the file as
+ *     shares.
+ * Effect:
+ *     The file is mapped into memory and read in windows, so it is not loaded
+ *     into the memory of the VM.
+ */
+template <typename T>
+NAMED_SYSCALL(classify_file_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<3, false, 0, 1>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(args[2u].p[0u]);
+        if (!destVec) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        const char * const fileName = static_cast<const char *>(crefs[0u].pData);
+        const std::string path = resolveDataFile(
+                pdpi->pdConfiguration().inputDirectory(),
+                std::string(fileName, strnlen(fileName, crefs[0u].size)));
+        if (path.empty()) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        using share_type = typename ValueTraits<T>::share_type;
+        static_assert(sizeof(share_type) ==
+                      sizeof(typename ValueTraits<T>::public_type), "");
+
+        ShareVec<T> & dest = *destVec;
+        const uint64_t offset = args[1u].uint64[0u];
+        const size_t num_bytes = dest.size() * sizeof(share_type);
+        const InputFile file(path);
+        if (offset > file.size() || num_bytes > file.size() - offset) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        file.read(offset, dest.data(), num_bytes);
+
+        // Boolean shares are kept as 0/1 bytes:
+        if (is_bool_value_tag<T>::value) {
+            for (share_type & value : dest)
+                value = (value != 0u);
+        }
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                        dest.size());
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: declassify_file_vec<T>
+ * Args:
+ *     0) uint64[0u]     pd index
+ *     1) p[0u]          handle to source vector
+ *     2) uint64[0u]     format, 0 for binary or 1 for text
+ * CRefs:
+ *     0) crefs[0u]      name of the file in the output directory
+ * Precondition:
+ *     The source handle is valid vector of type T.
+ *     The parent directory of the file is in the output directory given in
+ *     the configuration.
+ * Postcondition:
+ *     The file is created or truncated and contains the declassified values
+ *     of the source vector, either in the native byte order or in decimal,
+ *     one value per line.
+ * Effect:
+ *     The values are written in chunks, so they are not copied into the
+ *     memory of the VM.
+ */
+template <typename T>
+NAMED_SYSCALL(declassify_file_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<3, false, 0, 1>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        const ShareVec<T> * const srcVec =
+            pdpi->inputVector<T>(args[1u].p[0u]);
+        const uint64_t format = args[2u].uint64[0u];
+        if (!srcVec || format > 1u) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        const char * const fileName = static_cast<const char *>(crefs[0u].pData);
+        const std::string path = resolveOutputDataFile(
+                pdpi->pdConfiguration().outputDirectory(),
+                std::string(fileName, strnlen(fileName, crefs[0u].size)));
+        if (path.empty()) {
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
         }
 
-        for (size_t i = 0u; i < dest.size(); ++i)
-            dest[i] = src[i];
+        using share_type = typename ValueTraits<T>::share_type;
+        static_assert(sizeof(share_type) ==
+                      sizeof(typename ValueTraits<T>::public_type), "");
+
+        const ShareVec<T> & src = *srcVec;
+        OutputFile file(path);
+        if (format == 0u) {
+            file.write(src.data(), src.size() * sizeof(share_type));
+        } else {
+            // Widen to the overload of the same signedness:
+            using line_type = typename std::conditional<
+                    std::is_signed<share_type>::value,
+                    int64_t,
+                    uint64_t>::type;
+            for (const share_type value : src)
+                file.writeLine(static_cast<line_type>(value));
+        }
+        file.flush();
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
                         src.size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
@@ -497,7 +670,98 @@ NAMED_SYSCALL(delete_vec, name, args, num_args, refs, crefs, returnValue, c)
         const size_t vsize = vec->size();
         pdpi->freeRegisteredVector(vec);
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name, vsize);
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, vsize);
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: resize_vec<T>
+ * Args:
+ *      0) uint64[0u]     pd index
+ *      1) p[0u]          vector handle
+ *      2) uint64[0u]     new size of the vector
+ * Precondition:
+ *      The handle points to valid vector of type T.
+ * Postcondition:
+ *      The vector has the given size and the handle is unchanged. The
+ *      elements up to the smaller of the sizes are kept and new elements are
+ *      shares of zero.
+ * Effect:
+ *      Growing a vector beyond its capacity at least doubles the capacity.
+ */
+template <typename T>
+NAMED_SYSCALL(resize_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<3>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    using share_type = typename ValueTraits<T>::share_type;
+    const uint64_t size = args[2u].uint64[0u];
+    if (std::numeric_limits<size_t>::max() / 2u / sizeof(share_type) < size)
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL;
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        ShareVec<T> * const vec = pdpi->outputVector<T>(args[1u].p[0u]);
+        if (!vec) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        pdpi->resizeRegisteredVector(*vec, static_cast<size_t>(size));
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, vec->size());
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: reserve_vec<T>
+ * Args:
+ *      0) uint64[0u]     pd index
+ *      1) p[0u]          vector handle
+ *      2) uint64[0u]     number of elements to reserve storage for
+ * Precondition:
+ *      The handle points to valid vector of type T.
+ * Postcondition:
+ *      The vector can be resized up to the given number of elements without
+ *      reallocating its storage. Its size and contents are unchanged.
+ */
+template <typename T>
+NAMED_SYSCALL(reserve_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<3>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    using share_type = typename ValueTraits<T>::share_type;
+    const uint64_t capacity = args[2u].uint64[0u];
+    if (std::numeric_limits<size_t>::max() / 2u / sizeof(share_type) < capacity)
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL;
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        ShareVec<T> * const vec = pdpi->outputVector<T>(args[1u].p[0u]);
+        if (!vec) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        pdpi->reserveRegisteredVector(*vec, static_cast<size_t>(capacity));
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, capacity);
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -537,13 +801,15 @@ NAMED_SYSCALL(load_vec, name, args, num_args, refs, crefs, returnValue, c)
         void * const destHandle = args[3u].p[0u];
         uint64_t index = args[2u].uint64[0u];
 
-        if (!pdpi->isValidHandle<T>(srcHandle) ||
-            !pdpi->isValidHandle<T>(destHandle)) {
+        // Resolve the output before the input, see SpdzFrescoPDPI:
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(destHandle);
+        const ShareVec<T> * const srcVec = pdpi->inputVector<T>(srcHandle);
+        if (!destVec || !srcVec) {
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
         }
 
-        const ShareVec<T> & src = *static_cast<ShareVec<T>*>(srcHandle);
-        ShareVec<T> & dest = *static_cast<ShareVec<T>*>(destHandle);
+        const ShareVec<T> & src = *srcVec;
+        ShareVec<T> & dest = *destVec;
 
         if (dest.empty() || !(index < src.size())) {
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
@@ -551,7 +817,7 @@ NAMED_SYSCALL(load_vec, name, args, num_args, refs, crefs, returnValue, c)
 
         dest[0u] = src[index];
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name, 1u);
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, 1u);
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -591,13 +857,15 @@ NAMED_SYSCALL(store_vec, name, args, num_args, refs, crefs, returnValue, c)
         void * const destHandle = args[3u].p[0u];
         uint64_t index = args[2u].uint64[0u];
 
-        if (!pdpi->isValidHandle<T>(srcHandle) ||
-            !pdpi->isValidHandle<T>(destHandle)) {
+        // Resolve the output before the input, see SpdzFrescoPDPI:
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(destHandle);
+        const ShareVec<T> * const srcVec = pdpi->inputVector<T>(srcHandle);
+        if (!destVec || !srcVec) {
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
         }
 
-        const ShareVec<T> & src = *static_cast<ShareVec<T>*>(srcHandle);
-        ShareVec<T> & dest = *static_cast<ShareVec<T>*>(destHandle);
+        const ShareVec<T> & src = *srcVec;
+        ShareVec<T> & dest = *destVec;
 
         if (src.empty() || !(index < dest.size())) {
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
@@ -605,7 +873,326 @@ NAMED_SYSCALL(store_vec, name, args, num_args, refs, crefs, returnValue, c)
 
         dest[index] = src[0u];
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name, 1u);
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, 1u);
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: gather_vec<T>
+ * Args:
+ *     0) uint64[0u]     pd index
+ *     1) p[0u]          source vector handle
+ *     2) p[0u]          destination vector handle
+ * CRefs:
+ *     0) crefs[0u]      public uint64 indices into the source vector
+ * Precondition:
+ *     Both handles point to different valid vectors of type T.
+ *     The destination vector has as many elements as there are indices.
+ *     All indices are less than the size of the source vector.
+ * Postcondition:
+ *     Every position of the destination vector contains the share of the
+ *     source vector from the position denoted by the respective index.
+ * Effect:
+ *     No reclassification is performed.
+ */
+template <typename T>
+NAMED_SYSCALL(gather_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<3, false, 0, 1>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        void * const srcHandle = args[1u].p[0u];
+        void * const destHandle = args[2u].p[0u];
+
+        if (srcHandle == destHandle)
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+
+        // Resolve the output before the input, see SpdzFrescoPDPI:
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(destHandle);
+        const ShareVec<T> * const srcVec = pdpi->inputVector<T>(srcHandle);
+        if (!destVec || !srcVec) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        const ShareVec<T> & src = *srcVec;
+        ShareVec<T> & dest = *destVec;
+
+        const uint64_t * const indices =
+            static_cast<const uint64_t *>(crefs[0u].pData);
+        const size_t numIndices = crefs[0u].size / sizeof(uint64_t);
+
+        if (dest.size() != numIndices ||
+            !kernels::indicesInRange(indices, numIndices, src.size())) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        kernels::gather(src.data(), indices, dest.data(), numIndices);
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, numIndices);
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: scatter_vec<T>
+ * Args:
+ *     0) uint64[0u]     pd index
+ *     1) p[0u]          source vector handle
+ *     2) p[0u]          destination vector handle
+ * CRefs:
+ *     0) crefs[0u]      public uint64 indices into the destination vector
+ * Precondition:
+ *     Both handles point to different valid vectors of type T.
+ *     The source vector has as many elements as there are indices.
+ *     All indices are less than the size of the destination vector.
+ * Postcondition:
+ *     The positions of the destination vector denoted by the indices contain
+ *     the respective shares of the source vector. If an index occurs more
+ *     than once, the last occurrence takes effect.
+ * Effect:
+ *     No reclassification is performed.
+ */
+template <typename T>
+NAMED_SYSCALL(scatter_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<3, false, 0, 1>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        void * const srcHandle = args[1u].p[0u];
+        void * const destHandle = args[2u].p[0u];
+
+        if (srcHandle == destHandle)
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+
+        // Resolve the output before the input, see SpdzFrescoPDPI:
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(destHandle);
+        const ShareVec<T> * const srcVec = pdpi->inputVector<T>(srcHandle);
+        if (!destVec || !srcVec) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        const ShareVec<T> & src = *srcVec;
+        ShareVec<T> & dest = *destVec;
+
+        const uint64_t * const indices =
+            static_cast<const uint64_t *>(crefs[0u].pData);
+        const size_t numIndices = crefs[0u].size / sizeof(uint64_t);
+
+        if (src.size() != numIndices ||
+            !kernels::indicesInRange(indices, numIndices, dest.size())) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        kernels::scatter(src.data(), indices, dest.data(), numIndices);
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, numIndices);
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: slice_vec<T>
+ * Args:
+ *     0) uint64[0u]     pd index
+ *     1) p[0u]          source vector handle
+ *     2) uint64[0u]     begin index
+ *     3) uint64[0u]     end index
+ *     4) p[0u]          destination vector handle
+ * Precondition:
+ *     Both handles point to valid vectors of type T.
+ *     begin <= end <= size of the source vector.
+ *     The destination vector has end - begin elements.
+ * Postcondition:
+ *     The destination vector contains the shares of the source vector from
+ *     the positions [begin, end).
+ */
+template <typename T>
+NAMED_SYSCALL(slice_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<5>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        void * const srcHandle = args[1u].p[0u];
+        void * const destHandle = args[4u].p[0u];
+        const uint64_t begin = args[2u].uint64[0u];
+        const uint64_t end = args[3u].uint64[0u];
+
+        // Resolve the output before the input, see SpdzFrescoPDPI:
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(destHandle);
+        const ShareVec<T> * const srcVec = pdpi->inputVector<T>(srcHandle);
+        if (!destVec || !srcVec) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        const ShareVec<T> & src = *srcVec;
+        ShareVec<T> & dest = *destVec;
+
+        if (begin > end || end > src.size() || dest.size() != end - begin) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        using share_type = typename ValueTraits<T>::share_type;
+        if (!dest.empty())
+            std::memmove(dest.data(), src.data() + begin,
+                         dest.size() * sizeof(share_type));
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, dest.size());
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: concat_vec<T>
+ * Args:
+ *     0) uint64[0u]     pd index
+ *     1) p[0u]          first source vector handle
+ *     2) p[0u]          second source vector handle
+ *     3) p[0u]          destination vector handle
+ * Precondition:
+ *     All handles point to valid vectors of type T.
+ *     The size of the destination vector is the sum of the sizes of the
+ *     source vectors.
+ * Postcondition:
+ *     The destination vector contains the shares of the first source vector
+ *     followed by the shares of the second source vector.
+ */
+template <typename T>
+NAMED_SYSCALL(concat_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<4>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        void * const src1Handle = args[1u].p[0u];
+        void * const src2Handle = args[2u].p[0u];
+        void * const destHandle = args[3u].p[0u];
+
+        // Resolve the output before the inputs, see SpdzFrescoPDPI:
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(destHandle);
+        const ShareVec<T> * const src1Vec = pdpi->inputVector<T>(src1Handle);
+        const ShareVec<T> * const src2Vec = pdpi->inputVector<T>(src2Handle);
+        if (!destVec || !src1Vec || !src2Vec) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        const ShareVec<T> & src1 = *src1Vec;
+        const ShareVec<T> & src2 = *src2Vec;
+        ShareVec<T> & dest = *destVec;
+
+        if (dest.size() != src1.size() + src2.size()) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        // A source can only be the destination if the other one is empty,
+        // so memmove() is only needed for copying onto itself:
+        using share_type = typename ValueTraits<T>::share_type;
+        if (!src1.empty())
+            std::memmove(dest.data(), src1.data(),
+                         src1.size() * sizeof(share_type));
+        if (!src2.empty())
+            std::memmove(dest.data() + src1.size(), src2.data(),
+                         src2.size() * sizeof(share_type));
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, dest.size());
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors ();
+    }
+}
+
+/**
+ * SysCall: copy_range_vec<T>
+ * Args:
+ *     0) uint64[0u]     pd index
+ *     1) p[0u]          source vector handle
+ *     2) uint64[0u]     source begin index
+ *     3) p[0u]          destination vector handle
+ *     4) uint64[0u]     destination begin index
+ *     5) uint64[0u]     number of elements to copy
+ * Precondition:
+ *     Both handles point to valid vectors of type T.
+ *     Both ranges lie within their respective vectors.
+ * Postcondition:
+ *     The given range of the destination vector contains the shares of the
+ *     given range of the source vector. The ranges may overlap if the
+ *     source and destination vectors are the same.
+ */
+template <typename T>
+NAMED_SYSCALL(copy_range_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<6>::check(num_args, refs, crefs, returnValue) ||
+        !handles.get(c, args)) {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL; // Signal that the call was invalid.
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        void * const srcHandle = args[1u].p[0u];
+        void * const destHandle = args[3u].p[0u];
+        const uint64_t srcBegin = args[2u].uint64[0u];
+        const uint64_t destBegin = args[4u].uint64[0u];
+        const uint64_t count = args[5u].uint64[0u];
+
+        // Resolve the output before the input, see SpdzFrescoPDPI:
+        ShareVec<T> * const destVec = pdpi->outputVector<T>(destHandle);
+        const ShareVec<T> * const srcVec = pdpi->inputVector<T>(srcHandle);
+        if (!destVec || !srcVec) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        const ShareVec<T> & src = *srcVec;
+        ShareVec<T> & dest = *destVec;
+
+        if (srcBegin > src.size() || count > src.size() - srcBegin ||
+            destBegin > dest.size() || count > dest.size() - destBegin) {
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+        }
+
+        using share_type = typename ValueTraits<T>::share_type;
+        if (count > 0u)
+            std::memmove(dest.data() + destBegin, src.data() + srcBegin,
+                         count * sizeof(share_type));
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name, count);
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
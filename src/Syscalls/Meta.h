@@ -24,11 +24,21 @@
 #include <sharemind/VmVector.h>
 
 #include "Common.h"
+#include "../Protocols/Arithmetic.h"
+#include "../Protocols/Bitwise.h"
+#include "../Protocols/Choice.h"
+#include "../Protocols/Comparison.h"
+#include "../Protocols/Conversion.h"
+#include "../Protocols/FixedPoint.h"
+#include "../Protocols/Reduction.h"
+#include "../Protocols/Sort.h"
 #include "../SpdzFrescoPDPI.h"
 
 
 /**
- * Meta-syscalls for many common cases.
+ * Meta-syscalls for many common cases. The output handle of a syscall may be
+ * the same as any of its input handles of the same type, in which case the
+ * operation is performed in place.
  */
 
 namespace sharemind {
@@ -44,6 +54,8 @@ namespace sharemind {
  *      LHS handle is a vector of type T1.
  *      RHS handle is a vector of type T2.
  *      Output handle is a vector of type T3.
+ * Effect:
+ *      Runs the module-local kernel of the protocol if there is one.
  */
 template <typename T1, typename T2, typename T3, typename Protocol>
 NAMED_SYSCALL(binary_vec, name, args, num_args, refs, crefs, returnValue, c)
@@ -62,23 +74,19 @@ NAMED_SYSCALL(binary_vec, name, args, num_args, refs, crefs, returnValue, c)
         void * const rhsHandle = args[2u].p[0u];
         void * const resultHandle = args[3u].p[0u];
 
-        if (!pdpi->isValidHandle<T1>(lhsHandle) ||
-                !pdpi->isValidHandle<T2>(rhsHandle) ||
-                !pdpi->isValidHandle<T3>(resultHandle))
-        {
+        // Resolve the output before the inputs, see SpdzFrescoPDPI:
+        ShareVec<T3> * const result = pdpi->outputVector<T3>(resultHandle);
+        const ShareVec<T1> * const param1 = pdpi->inputVector<T1>(lhsHandle);
+        const ShareVec<T2> * const param2 = pdpi->inputVector<T2>(rhsHandle);
+        if (!result || !param1 || !param2)
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
-        }
 
-        const ShareVec<T1> & param1 = *static_cast<ShareVec<T1>*>(lhsHandle);
-        const ShareVec<T2> & param2 = *static_cast<ShareVec<T2>*>(rhsHandle);
-        ShareVec<T3> & result = *static_cast<ShareVec<T3>*>(resultHandle);
-
-        Protocol protocol(*pdpi);
-        if (!protocol.invoke(param1, param2, result))
+        typename KernelProtocol<T1, Protocol>::type protocol(*pdpi);
+        if (!protocol.invoke(*param1, *param2, *result))
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
-                        param1.size());
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                        param1->size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -92,9 +100,12 @@ NAMED_SYSCALL(binary_vec, name, args, num_args, refs, crefs, returnValue, c)
  *      0) uint64[0]     pd index
  *      1) p[0]          LHS handle
  *      2) p[0]          output handle
+ * CRefs:
+ *      0) crefs[0]      public RHS data
  * Precondition:
  *      LHS handle is a vector of type T1.
- *      RHS handle is a vector of type T2.
+ *      RHS data holds a single value or as many values of type T2 as the
+ *      LHS vector. A single value is applied to every element.
  *      Output handle is a vector of type T3.
  */
 template <typename T1, typename T2, typename T3, typename Protocol>
@@ -113,22 +124,20 @@ NAMED_SYSCALL(binary_public_vec, name, args, num_args, refs, crefs, returnValue,
         void * const lhsHandle = args[1u].p[0u];
         void * const resultHandle = args[2u].p[0u];
 
-        if (!pdpi->isValidHandle<T1>(lhsHandle) ||
-                !pdpi->isValidHandle<T3>(resultHandle))
-        {
+        // Resolve the output before the inputs, see SpdzFrescoPDPI:
+        ShareVec<T3> * const result = pdpi->outputVector<T3>(resultHandle);
+        const ShareVec<T1> * const param1 = pdpi->inputVector<T1>(lhsHandle);
+        if (!result || !param1)
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
-        }
 
-        const ShareVec<T1> & param1 = *static_cast<ShareVec<T1>*>(lhsHandle);
         const ImmutableVmVec<T2> param2(crefs[0u]);
-        ShareVec<T3> & result = *static_cast<ShareVec<T3>*>(resultHandle);
 
-        Protocol protocol(*pdpi);
-        if (!protocol.invoke(param1, param2, result))
+        typename KernelProtocol<T1, Protocol>::type protocol(*pdpi);
+        if (!protocol.invoke(*param1, param2, *result))
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
-                        param1.size());
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                        param1->size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -168,6 +177,51 @@ NAMED_SYSCALL(binary_arith_public_vec, name, args, num_args, refs, crefs, return
     return binary_public_vec<T, T, T, Protocol>(name, args, num_args, refs, crefs, returnValue, c);
 }
 
+/**
+ * SysCall: binary_assign_vec<T, Protocol>
+ * Args:
+ *      0) uint64[0]     pd index
+ *      1) p[0]          vector handle (lhs and output)
+ *      2) p[0]          vector handle (rhs)
+ * Precondition:
+ *      Both handles are valid vectors of type T.
+ * Postcondition:
+ *      The lhs vector is replaced by the result of the operation.
+ */
+template <typename T, typename Protocol>
+NAMED_SYSCALL(binary_assign_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    if (!SyscallArgs<3>::check(num_args, refs, crefs, returnValue))
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL;
+
+    SharemindCodeBlock forwardedArgs[4u] = { args[0u], args[1u], args[2u], args[1u] };
+    return binary_vec<T, T, T, Protocol>(name, forwardedArgs, 4u, refs, crefs, returnValue, c);
+}
+
+/**
+ * SysCall: binary_assign_public_vec<T, Protocol>
+ * Args:
+ *      0) uint64[0]     pd index
+ *      1) p[0]          vector handle (lhs and output)
+ * CRefs:
+ *      0) crefs[0]      public RHS data
+ * Precondition:
+ *      The handle is a valid vector of type T.
+ *      RHS data holds a single value or as many values of type T as the
+ *      vector. A single value is applied to every element.
+ * Postcondition:
+ *      The lhs vector is replaced by the result of the operation.
+ */
+template <typename T, typename Protocol>
+NAMED_SYSCALL(binary_assign_public_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    if (!SyscallArgs<2, false, 0u, 1u>::check(num_args, refs, crefs, returnValue))
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL;
+
+    SharemindCodeBlock forwardedArgs[3u] = { args[0u], args[1u], args[1u] };
+    return binary_public_vec<T, T, T, Protocol>(name, forwardedArgs, 3u, refs, crefs, returnValue, c);
+}
+
 /**
  * SysCall: unary_vec<T, L, Protocol>
  * Args:
@@ -194,21 +248,18 @@ NAMED_SYSCALL(unary_vec, name, args, num_args, refs, crefs, returnValue, c)
         void * const paramHandle = args[1u].p[0u];
         void * const resultHandle = args[2u].p[0u];
 
-        if (!pdpi->isValidHandle<T>(paramHandle) ||
-                !pdpi->isValidHandle<L>(resultHandle))
-        {
+        // Resolve the output before the input, see SpdzFrescoPDPI:
+        ShareVec<L> * const result = pdpi->outputVector<L>(resultHandle);
+        const ShareVec<T> * const param = pdpi->inputVector<T>(paramHandle);
+        if (!result || !param)
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
-        }
-
-        const ShareVec<T>& param = *static_cast<ShareVec<T>*>(paramHandle);
-        ShareVec<L>& result = *static_cast<ShareVec<L>*>(resultHandle);
 
-        Protocol protocol(*pdpi);
-        if (!protocol.invoke(param, result))
+        typename KernelProtocol<T, Protocol>::type protocol(*pdpi);
+        if (!protocol.invoke(*param, *result))
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
-                        param.size());
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                        param->size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -231,6 +282,55 @@ NAMED_SYSCALL(unary_arith_vec, name, args, num_args, refs, crefs, returnValue, c
     return unary_vec<T, T, Protocol>(name, args, num_args, refs, crefs, returnValue, c);
 }
 
+/**
+ * SysCall: shuffle_vec<T>
+ * Args:
+ *      0) uint64[0]     pd index
+ *      1) p[0]          input handle
+ *      2) p[0]          output handle
+ * Precondition:
+ *      Both handles are valid vectors of type T.
+ * Effect:
+ *      Like unary_arith_vec with ShuffleProtocol, but vectors of fewer than
+ *      two elements are not profiled. There is nothing to permute, and the
+ *      time models of shuffles are only defined from two elements up.
+ */
+template <typename T>
+NAMED_SYSCALL(shuffle_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<3>::check(num_args, refs, crefs, returnValue) ||
+            !handles.get(c, args))
+    {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL;
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI *>(handles.pdpiHandle);
+
+        void * const paramHandle = args[1u].p[0u];
+        void * const resultHandle = args[2u].p[0u];
+
+        // Resolve the output before the input, see SpdzFrescoPDPI:
+        ShareVec<T> * const result = pdpi->outputVector<T>(resultHandle);
+        const ShareVec<T> * const param = pdpi->inputVector<T>(paramHandle);
+        if (!result || !param)
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+
+        ShuffleProtocol<SpdzFrescoPDPI> protocol(*pdpi);
+        if (!protocol.invoke(*param, *result))
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+
+        if (param->size() >= 2u)
+            PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                            param->size());
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors();
+    }
+}
+
 /**
  * SysCall: nullary_vec<T, Protocol>
  * Args:
@@ -254,17 +354,15 @@ NAMED_SYSCALL(nullary_vec, name, args, num_args, refs, crefs, returnValue, c)
 
         void * const resultHandle = args[1u].p[0u];
 
-        if (!pdpi->isValidHandle<T>(resultHandle)) {
+        ShareVec<T> * const result = pdpi->outputVector<T>(resultHandle);
+        if (!result)
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
-        }
 
-        ShareVec<T> & result = *static_cast<ShareVec<T>*>(resultHandle);
-
-        if (!Protocol(*pdpi).invoke(result))
+        if (!Protocol(*pdpi).invoke(*result))
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
-                        result.size());
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                        result->size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -304,25 +402,76 @@ NAMED_SYSCALL(ternary_vec, name, args, num_args, refs, crefs, returnValue, c)
         void * const param3Handle = args[3u].p[0u];
         void * const resultHandle = args[4u].p[0u];
 
-        if (!pdpi->isValidHandle<T1>(param1Handle) ||
-                !pdpi->isValidHandle<T2>(param2Handle) ||
-                !pdpi->isValidHandle<T3>(param3Handle) ||
-                !pdpi->isValidHandle<T4>(resultHandle))
-        {
+        // Resolve the output before the inputs, see SpdzFrescoPDPI:
+        ShareVec<T4> * const result = pdpi->outputVector<T4>(resultHandle);
+        const ShareVec<T1> * const param1 = pdpi->inputVector<T1>(param1Handle);
+        const ShareVec<T2> * const param2 = pdpi->inputVector<T2>(param2Handle);
+        const ShareVec<T3> * const param3 = pdpi->inputVector<T3>(param3Handle);
+        if (!result || !param1 || !param2 || !param3)
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+
+        typename KernelProtocol<T2, Protocol>::type protocol(*pdpi);
+        if (!protocol.invoke(*param1, *param2, *param3, *result))
+            return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
+
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                        param1->size());
+
+        return SHAREMIND_MODULE_API_0x1_OK;
+    } catch (...) {
+        return catchModuleApiErrors();
+    }
+}
+
+/**
+ * SysCall: ternary_public_vec<T1, T2, T3, T4, Protocol>
+ * Args:
+ *      0) uint64[0]     pd index
+ *      1) p[0]          first parameter handle
+ *      2) p[0]          second parameter handle
+ *      3) p[0]          output handle
+ * CRefs:
+ *      0) crefs[0]      public third parameter data
+ * Precondition:
+ *      first parameter handle is a vector of type T1.
+ *      second parameter handle is a vector of type T2.
+ *      third parameter data holds a single value or as many values of type
+ *      T3 as the first parameter. A single value is applied to every
+ *      element.
+ *      Output handle is a vector of type T4.
+ */
+template <typename T1, typename T2, typename T3, typename T4, typename Protocol>
+NAMED_SYSCALL(ternary_public_vec, name, args, num_args, refs, crefs, returnValue, c)
+{
+    VMHandles handles;
+    if (!SyscallArgs<4, false, 0u, 1u>::check(num_args, refs, crefs, returnValue) ||
+            !handles.get(c, args))
+    {
+        return SHAREMIND_MODULE_API_0x1_INVALID_CALL;
+    }
+
+    try {
+        SpdzFrescoPDPI * const pdpi = static_cast<SpdzFrescoPDPI*>(handles.pdpiHandle);
+
+        void * const param1Handle = args[1u].p[0u];
+        void * const param2Handle = args[2u].p[0u];
+        void * const resultHandle = args[3u].p[0u];
+
+        // Resolve the output before the inputs, see SpdzFrescoPDPI:
+        ShareVec<T4> * const result = pdpi->outputVector<T4>(resultHandle);
+        const ShareVec<T1> * const param1 = pdpi->inputVector<T1>(param1Handle);
+        const ShareVec<T2> * const param2 = pdpi->inputVector<T2>(param2Handle);
+        if (!result || !param1 || !param2)
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
-        }
 
-        const ShareVec<T1> & param1 = *static_cast<ShareVec<T1>*>(param1Handle);
-        const ShareVec<T2> & param2 = *static_cast<ShareVec<T2>*>(param2Handle);
-        const ShareVec<T3> & param3 = *static_cast<ShareVec<T3>*>(param3Handle);
-        ShareVec<T4> & result = *static_cast<ShareVec<T4>*>(resultHandle);
+        const ImmutableVmVec<T3> param3(crefs[0u]);
 
-        Protocol protocol(*pdpi);
-        if (!protocol.invoke(param1, param2, param3, result))
+        typename KernelProtocol<T2, Protocol>::type protocol(*pdpi);
+        if (!protocol.invoke(*param1, *param2, param3, *result))
             return SHAREMIND_MODULE_API_0x1_GENERAL_ERROR;
 
-        PROFILE_SYSCALL(c, pdpi->modelEvaluator(), name,
-                        param1.size());
+        PROFILE_SYSCALL(c, pdpi->profilingContext(), name,
+                        param1->size());
 
         return SHAREMIND_MODULE_API_0x1_OK;
     } catch (...) {
@@ -0,0 +1,596 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_SYSCALLS_SYSCALLIDS_H
+#define MOD_SPDZ_FRESCO_EMU_SYSCALLS_SYSCALLIDS_H
+
+#include <cstddef>
+
+
+/**
+ * List of all named syscalls of the module. Every syscall registered with
+ * NAMED_SYSCALL_WRAPPER must be listed here.
+ */
+#define SPDZ_FRESCO_EMU_SYSCALLS(X) \
+    X(new_uint32_vec) \
+    X(new_uint64_vec) \
+    X(init_uint32_vec) \
+    X(init_uint64_vec) \
+    X(set_shares_uint32_vec) \
+    X(set_shares_uint64_vec) \
+    X(get_shares_uint32_vec) \
+    X(get_shares_uint64_vec) \
+    X(fill_uint32_vec) \
+    X(fill_uint64_vec) \
+    X(assign_uint32_vec) \
+    X(assign_uint64_vec) \
+    X(delete_uint32_vec) \
+    X(delete_uint64_vec) \
+    X(load_uint32_vec) \
+    X(load_uint64_vec) \
+    X(store_uint32_vec) \
+    X(store_uint64_vec) \
+    X(classify_uint32_vec) \
+    X(classify_uint64_vec) \
+    X(declassify_uint32_vec) \
+    X(declassify_uint64_vec) \
+    X(get_type_size_uint32) \
+    X(get_type_size_uint64) \
+    X(add_uint32_vec) \
+    X(add_uint64_vec) \
+    X(sub_uint32_vec) \
+    X(sub_uint64_vec) \
+    X(mul_uint32_vec) \
+    X(mul_uint64_vec) \
+    X(eq_uint32_vec) \
+    X(eq_uint64_vec) \
+    X(gt_uint32_vec) \
+    X(gt_uint64_vec) \
+    X(gte_uint32_vec) \
+    X(gte_uint64_vec) \
+    X(lt_uint32_vec) \
+    X(lt_uint64_vec) \
+    X(lte_uint32_vec) \
+    X(lte_uint64_vec) \
+    X(conv_uint64_to_uint32_vec) \
+    X(conv_uint32_to_uint64_vec) \
+    X(choose_uint32_vec) \
+    X(choose_uint64_vec) \
+    X(new_bool_vec) \
+    X(delete_bool_vec) \
+    X(get_shares_bool_vec) \
+    X(declassify_bool_vec) \
+    X(get_type_size_bool) \
+    X(eq_uint32_to_bool_vec) \
+    X(eq_uint64_to_bool_vec) \
+    X(gt_uint32_to_bool_vec) \
+    X(gt_uint64_to_bool_vec) \
+    X(gte_uint32_to_bool_vec) \
+    X(gte_uint64_to_bool_vec) \
+    X(lt_uint32_to_bool_vec) \
+    X(lt_uint64_to_bool_vec) \
+    X(lte_uint32_to_bool_vec) \
+    X(lte_uint64_to_bool_vec) \
+    X(add_public_uint32_vec) \
+    X(add_public_uint64_vec) \
+    X(sub_public_uint32_vec) \
+    X(sub_public_uint64_vec) \
+    X(mul_public_uint32_vec) \
+    X(mul_public_uint64_vec) \
+    X(eq_public_uint32_vec) \
+    X(eq_public_uint64_vec) \
+    X(gt_public_uint32_vec) \
+    X(gt_public_uint64_vec) \
+    X(gte_public_uint32_vec) \
+    X(gte_public_uint64_vec) \
+    X(lt_public_uint32_vec) \
+    X(lt_public_uint64_vec) \
+    X(lte_public_uint32_vec) \
+    X(lte_public_uint64_vec) \
+    X(eq_public_uint32_to_bool_vec) \
+    X(eq_public_uint64_to_bool_vec) \
+    X(gt_public_uint32_to_bool_vec) \
+    X(gt_public_uint64_to_bool_vec) \
+    X(gte_public_uint32_to_bool_vec) \
+    X(gte_public_uint64_to_bool_vec) \
+    X(lt_public_uint32_to_bool_vec) \
+    X(lt_public_uint64_to_bool_vec) \
+    X(lte_public_uint32_to_bool_vec) \
+    X(lte_public_uint64_to_bool_vec) \
+    X(fma_uint32_vec) \
+    X(fma_uint64_vec) \
+    X(mul_add_public_uint32_vec) \
+    X(mul_add_public_uint64_vec) \
+    X(sum_uint32_vec) \
+    X(sum_uint64_vec) \
+    X(product_uint32_vec) \
+    X(product_uint64_vec) \
+    X(min_uint32_vec) \
+    X(min_uint64_vec) \
+    X(max_uint32_vec) \
+    X(max_uint64_vec) \
+    X(prefix_sum_uint32_vec) \
+    X(prefix_sum_uint64_vec) \
+    X(gather_uint32_vec) \
+    X(gather_uint64_vec) \
+    X(scatter_uint32_vec) \
+    X(scatter_uint64_vec) \
+    X(slice_uint32_vec) \
+    X(slice_uint64_vec) \
+    X(concat_uint32_vec) \
+    X(concat_uint64_vec) \
+    X(copy_range_uint32_vec) \
+    X(copy_range_uint64_vec) \
+    X(classify_file_uint32_vec) \
+    X(classify_file_uint64_vec) \
+    X(declassify_file_uint32_vec) \
+    X(declassify_file_uint64_vec) \
+    X(declassify_file_bool_vec) \
+    X(add_assign_uint32_vec) \
+    X(add_assign_uint64_vec) \
+    X(sub_assign_uint32_vec) \
+    X(sub_assign_uint64_vec) \
+    X(mul_assign_uint32_vec) \
+    X(mul_assign_uint64_vec) \
+    X(add_assign_public_uint32_vec) \
+    X(add_assign_public_uint64_vec) \
+    X(sub_assign_public_uint32_vec) \
+    X(sub_assign_public_uint64_vec) \
+    X(mul_assign_public_uint32_vec) \
+    X(mul_assign_public_uint64_vec) \
+    X(resize_uint32_vec) \
+    X(resize_uint64_vec) \
+    X(reserve_uint32_vec) \
+    X(reserve_uint64_vec) \
+    X(resize_bool_vec) \
+    X(reserve_bool_vec) \
+    X(shuffle_uint32_vec) \
+    X(sort_uint32_vec) \
+    X(sort_by_key_uint32_vec) \
+    X(shuffle_uint64_vec) \
+    X(sort_uint64_vec) \
+    X(sort_by_key_uint64_vec) \
+    X(new_int32_vec) \
+    X(new_int64_vec) \
+    X(init_int32_vec) \
+    X(init_int64_vec) \
+    X(set_shares_int32_vec) \
+    X(set_shares_int64_vec) \
+    X(get_shares_int32_vec) \
+    X(get_shares_int64_vec) \
+    X(fill_int32_vec) \
+    X(fill_int64_vec) \
+    X(assign_int32_vec) \
+    X(assign_int64_vec) \
+    X(delete_int32_vec) \
+    X(delete_int64_vec) \
+    X(resize_int32_vec) \
+    X(resize_int64_vec) \
+    X(reserve_int32_vec) \
+    X(reserve_int64_vec) \
+    X(load_int32_vec) \
+    X(load_int64_vec) \
+    X(store_int32_vec) \
+    X(store_int64_vec) \
+    X(gather_int32_vec) \
+    X(gather_int64_vec) \
+    X(scatter_int32_vec) \
+    X(scatter_int64_vec) \
+    X(slice_int32_vec) \
+    X(slice_int64_vec) \
+    X(concat_int32_vec) \
+    X(concat_int64_vec) \
+    X(copy_range_int32_vec) \
+    X(copy_range_int64_vec) \
+    X(classify_int32_vec) \
+    X(classify_int64_vec) \
+    X(classify_file_int32_vec) \
+    X(classify_file_int64_vec) \
+    X(declassify_int32_vec) \
+    X(declassify_int64_vec) \
+    X(declassify_file_int32_vec) \
+    X(declassify_file_int64_vec) \
+    X(get_type_size_int32) \
+    X(get_type_size_int64) \
+    X(add_int32_vec) \
+    X(add_int64_vec) \
+    X(sub_int32_vec) \
+    X(sub_int64_vec) \
+    X(mul_int32_vec) \
+    X(mul_int64_vec) \
+    X(add_public_int32_vec) \
+    X(add_public_int64_vec) \
+    X(sub_public_int32_vec) \
+    X(sub_public_int64_vec) \
+    X(mul_public_int32_vec) \
+    X(mul_public_int64_vec) \
+    X(add_assign_int32_vec) \
+    X(add_assign_int64_vec) \
+    X(sub_assign_int32_vec) \
+    X(sub_assign_int64_vec) \
+    X(mul_assign_int32_vec) \
+    X(mul_assign_int64_vec) \
+    X(add_assign_public_int32_vec) \
+    X(add_assign_public_int64_vec) \
+    X(sub_assign_public_int32_vec) \
+    X(sub_assign_public_int64_vec) \
+    X(mul_assign_public_int32_vec) \
+    X(mul_assign_public_int64_vec) \
+    X(fma_int32_vec) \
+    X(fma_int64_vec) \
+    X(mul_add_public_int32_vec) \
+    X(mul_add_public_int64_vec) \
+    X(sum_int32_vec) \
+    X(sum_int64_vec) \
+    X(product_int32_vec) \
+    X(product_int64_vec) \
+    X(min_int32_vec) \
+    X(min_int64_vec) \
+    X(max_int32_vec) \
+    X(max_int64_vec) \
+    X(prefix_sum_int32_vec) \
+    X(prefix_sum_int64_vec) \
+    X(eq_int32_vec) \
+    X(eq_int64_vec) \
+    X(gt_int32_vec) \
+    X(gt_int64_vec) \
+    X(gte_int32_vec) \
+    X(gte_int64_vec) \
+    X(lt_int32_vec) \
+    X(lt_int64_vec) \
+    X(lte_int32_vec) \
+    X(lte_int64_vec) \
+    X(eq_int32_to_bool_vec) \
+    X(eq_int64_to_bool_vec) \
+    X(gt_int32_to_bool_vec) \
+    X(gt_int64_to_bool_vec) \
+    X(gte_int32_to_bool_vec) \
+    X(gte_int64_to_bool_vec) \
+    X(lt_int32_to_bool_vec) \
+    X(lt_int64_to_bool_vec) \
+    X(lte_int32_to_bool_vec) \
+    X(lte_int64_to_bool_vec) \
+    X(eq_public_int32_vec) \
+    X(eq_public_int64_vec) \
+    X(gt_public_int32_vec) \
+    X(gt_public_int64_vec) \
+    X(gte_public_int32_vec) \
+    X(gte_public_int64_vec) \
+    X(lt_public_int32_vec) \
+    X(lt_public_int64_vec) \
+    X(lte_public_int32_vec) \
+    X(lte_public_int64_vec) \
+    X(eq_public_int32_to_bool_vec) \
+    X(eq_public_int64_to_bool_vec) \
+    X(gt_public_int32_to_bool_vec) \
+    X(gt_public_int64_to_bool_vec) \
+    X(gte_public_int32_to_bool_vec) \
+    X(gte_public_int64_to_bool_vec) \
+    X(lt_public_int32_to_bool_vec) \
+    X(lt_public_int64_to_bool_vec) \
+    X(lte_public_int32_to_bool_vec) \
+    X(lte_public_int64_to_bool_vec) \
+    X(conv_int64_to_int32_vec) \
+    X(conv_int32_to_int64_vec) \
+    X(conv_int32_to_uint32_vec) \
+    X(conv_uint32_to_int32_vec) \
+    X(conv_int64_to_uint64_vec) \
+    X(conv_uint64_to_int64_vec) \
+    X(choose_int32_vec) \
+    X(choose_int64_vec) \
+    X(shuffle_int32_vec) \
+    X(sort_int32_vec) \
+    X(sort_by_key_int32_vec) \
+    X(shuffle_int64_vec) \
+    X(sort_int64_vec) \
+    X(sort_by_key_int64_vec) \
+    X(init_bool_vec) \
+    X(set_shares_bool_vec) \
+    X(fill_bool_vec) \
+    X(assign_bool_vec) \
+    X(load_bool_vec) \
+    X(store_bool_vec) \
+    X(gather_bool_vec) \
+    X(scatter_bool_vec) \
+    X(slice_bool_vec) \
+    X(concat_bool_vec) \
+    X(copy_range_bool_vec) \
+    X(classify_bool_vec) \
+    X(classify_file_bool_vec) \
+    X(new_uint8_vec) \
+    X(new_uint16_vec) \
+    X(init_uint8_vec) \
+    X(init_uint16_vec) \
+    X(set_shares_uint8_vec) \
+    X(set_shares_uint16_vec) \
+    X(get_shares_uint8_vec) \
+    X(get_shares_uint16_vec) \
+    X(fill_uint8_vec) \
+    X(fill_uint16_vec) \
+    X(assign_uint8_vec) \
+    X(assign_uint16_vec) \
+    X(delete_uint8_vec) \
+    X(delete_uint16_vec) \
+    X(resize_uint8_vec) \
+    X(resize_uint16_vec) \
+    X(reserve_uint8_vec) \
+    X(reserve_uint16_vec) \
+    X(load_uint8_vec) \
+    X(load_uint16_vec) \
+    X(store_uint8_vec) \
+    X(store_uint16_vec) \
+    X(gather_uint8_vec) \
+    X(gather_uint16_vec) \
+    X(scatter_uint8_vec) \
+    X(scatter_uint16_vec) \
+    X(slice_uint8_vec) \
+    X(slice_uint16_vec) \
+    X(concat_uint8_vec) \
+    X(concat_uint16_vec) \
+    X(copy_range_uint8_vec) \
+    X(copy_range_uint16_vec) \
+    X(classify_uint8_vec) \
+    X(classify_uint16_vec) \
+    X(classify_file_uint8_vec) \
+    X(classify_file_uint16_vec) \
+    X(declassify_uint8_vec) \
+    X(declassify_uint16_vec) \
+    X(declassify_file_uint8_vec) \
+    X(declassify_file_uint16_vec) \
+    X(get_type_size_uint8) \
+    X(get_type_size_uint16) \
+    X(add_uint8_vec) \
+    X(add_uint16_vec) \
+    X(sub_uint8_vec) \
+    X(sub_uint16_vec) \
+    X(mul_uint8_vec) \
+    X(mul_uint16_vec) \
+    X(add_public_uint8_vec) \
+    X(add_public_uint16_vec) \
+    X(sub_public_uint8_vec) \
+    X(sub_public_uint16_vec) \
+    X(mul_public_uint8_vec) \
+    X(mul_public_uint16_vec) \
+    X(add_assign_uint8_vec) \
+    X(add_assign_uint16_vec) \
+    X(sub_assign_uint8_vec) \
+    X(sub_assign_uint16_vec) \
+    X(mul_assign_uint8_vec) \
+    X(mul_assign_uint16_vec) \
+    X(add_assign_public_uint8_vec) \
+    X(add_assign_public_uint16_vec) \
+    X(sub_assign_public_uint8_vec) \
+    X(sub_assign_public_uint16_vec) \
+    X(mul_assign_public_uint8_vec) \
+    X(mul_assign_public_uint16_vec) \
+    X(fma_uint8_vec) \
+    X(fma_uint16_vec) \
+    X(mul_add_public_uint8_vec) \
+    X(mul_add_public_uint16_vec) \
+    X(sum_uint8_vec) \
+    X(sum_uint16_vec) \
+    X(product_uint8_vec) \
+    X(product_uint16_vec) \
+    X(min_uint8_vec) \
+    X(min_uint16_vec) \
+    X(max_uint8_vec) \
+    X(max_uint16_vec) \
+    X(prefix_sum_uint8_vec) \
+    X(prefix_sum_uint16_vec) \
+    X(eq_uint8_vec) \
+    X(eq_uint16_vec) \
+    X(gt_uint8_vec) \
+    X(gt_uint16_vec) \
+    X(gte_uint8_vec) \
+    X(gte_uint16_vec) \
+    X(lt_uint8_vec) \
+    X(lt_uint16_vec) \
+    X(lte_uint8_vec) \
+    X(lte_uint16_vec) \
+    X(eq_uint8_to_bool_vec) \
+    X(eq_uint16_to_bool_vec) \
+    X(gt_uint8_to_bool_vec) \
+    X(gt_uint16_to_bool_vec) \
+    X(gte_uint8_to_bool_vec) \
+    X(gte_uint16_to_bool_vec) \
+    X(lt_uint8_to_bool_vec) \
+    X(lt_uint16_to_bool_vec) \
+    X(lte_uint8_to_bool_vec) \
+    X(lte_uint16_to_bool_vec) \
+    X(eq_public_uint8_vec) \
+    X(eq_public_uint16_vec) \
+    X(gt_public_uint8_vec) \
+    X(gt_public_uint16_vec) \
+    X(gte_public_uint8_vec) \
+    X(gte_public_uint16_vec) \
+    X(lt_public_uint8_vec) \
+    X(lt_public_uint16_vec) \
+    X(lte_public_uint8_vec) \
+    X(lte_public_uint16_vec) \
+    X(eq_public_uint8_to_bool_vec) \
+    X(eq_public_uint16_to_bool_vec) \
+    X(gt_public_uint8_to_bool_vec) \
+    X(gt_public_uint16_to_bool_vec) \
+    X(gte_public_uint8_to_bool_vec) \
+    X(gte_public_uint16_to_bool_vec) \
+    X(lt_public_uint8_to_bool_vec) \
+    X(lt_public_uint16_to_bool_vec) \
+    X(lte_public_uint8_to_bool_vec) \
+    X(lte_public_uint16_to_bool_vec) \
+    X(eq_bool_vec) \
+    X(conv_uint16_to_uint8_vec) \
+    X(conv_uint8_to_uint16_vec) \
+    X(conv_uint32_to_uint8_vec) \
+    X(conv_uint8_to_uint32_vec) \
+    X(conv_uint32_to_uint16_vec) \
+    X(conv_uint16_to_uint32_vec) \
+    X(conv_uint64_to_uint8_vec) \
+    X(conv_uint8_to_uint64_vec) \
+    X(conv_uint64_to_uint16_vec) \
+    X(conv_uint16_to_uint64_vec) \
+    X(conv_bool_to_uint8_vec) \
+    X(conv_uint8_to_bool_vec) \
+    X(conv_bool_to_uint16_vec) \
+    X(conv_uint16_to_bool_vec) \
+    X(conv_bool_to_uint32_vec) \
+    X(conv_uint32_to_bool_vec) \
+    X(conv_bool_to_uint64_vec) \
+    X(conv_uint64_to_bool_vec) \
+    X(choose_bool_vec) \
+    X(choose_uint8_vec) \
+    X(choose_uint16_vec) \
+    X(shuffle_uint8_vec) \
+    X(sort_uint8_vec) \
+    X(sort_by_key_uint8_vec) \
+    X(shuffle_uint16_vec) \
+    X(sort_uint16_vec) \
+    X(sort_by_key_uint16_vec) \
+    X(new_fix64_vec) \
+    X(init_fix64_vec) \
+    X(set_shares_fix64_vec) \
+    X(get_shares_fix64_vec) \
+    X(fill_fix64_vec) \
+    X(assign_fix64_vec) \
+    X(delete_fix64_vec) \
+    X(resize_fix64_vec) \
+    X(reserve_fix64_vec) \
+    X(load_fix64_vec) \
+    X(store_fix64_vec) \
+    X(gather_fix64_vec) \
+    X(scatter_fix64_vec) \
+    X(slice_fix64_vec) \
+    X(concat_fix64_vec) \
+    X(copy_range_fix64_vec) \
+    X(classify_fix64_vec) \
+    X(classify_file_fix64_vec) \
+    X(declassify_fix64_vec) \
+    X(declassify_file_fix64_vec) \
+    X(get_type_size_fix64) \
+    X(add_fix64_vec) \
+    X(sub_fix64_vec) \
+    X(mul_fix64_vec) \
+    X(div_fix64_vec) \
+    X(add_public_fix64_vec) \
+    X(sub_public_fix64_vec) \
+    X(mul_public_fix64_vec) \
+    X(div_public_fix64_vec) \
+    X(sqrt_fix64_vec) \
+    X(sum_fix64_vec) \
+    X(min_fix64_vec) \
+    X(max_fix64_vec) \
+    X(eq_fix64_to_bool_vec) \
+    X(gt_fix64_to_bool_vec) \
+    X(gte_fix64_to_bool_vec) \
+    X(lt_fix64_to_bool_vec) \
+    X(lte_fix64_to_bool_vec) \
+    X(eq_public_fix64_to_bool_vec) \
+    X(gt_public_fix64_to_bool_vec) \
+    X(gte_public_fix64_to_bool_vec) \
+    X(lt_public_fix64_to_bool_vec) \
+    X(lte_public_fix64_to_bool_vec) \
+    X(conv_int64_to_fix64_vec) \
+    X(conv_fix64_to_int64_vec) \
+    X(choose_fix64_vec) \
+    X(shuffle_fix64_vec) \
+    X(sort_fix64_vec) \
+    X(div_uint32_vec) \
+    X(div_uint64_vec) \
+    X(mod_uint32_vec) \
+    X(mod_uint64_vec) \
+    X(shl_uint32_vec) \
+    X(shl_uint64_vec) \
+    X(shr_uint32_vec) \
+    X(shr_uint64_vec) \
+    X(div_public_uint32_vec) \
+    X(div_public_uint64_vec) \
+    X(mod_public_uint32_vec) \
+    X(mod_public_uint64_vec) \
+    X(shl_public_uint32_vec) \
+    X(shl_public_uint64_vec) \
+    X(shr_public_uint32_vec) \
+    X(shr_public_uint64_vec) \
+    X(and_bool_vec) \
+    X(or_bool_vec) \
+    X(xor_bool_vec) \
+    X(and_uint8_vec) \
+    X(and_uint16_vec) \
+    X(and_uint32_vec) \
+    X(and_uint64_vec) \
+    X(or_uint8_vec) \
+    X(or_uint16_vec) \
+    X(or_uint32_vec) \
+    X(or_uint64_vec) \
+    X(xor_uint8_vec) \
+    X(xor_uint16_vec) \
+    X(xor_uint32_vec) \
+    X(xor_uint64_vec) \
+    X(and_public_uint8_vec) \
+    X(and_public_uint16_vec) \
+    X(and_public_uint32_vec) \
+    X(and_public_uint64_vec) \
+    X(or_public_uint8_vec) \
+    X(or_public_uint16_vec) \
+    X(or_public_uint32_vec) \
+    X(or_public_uint64_vec) \
+    X(xor_public_uint8_vec) \
+    X(xor_public_uint16_vec) \
+    X(xor_public_uint32_vec) \
+    X(xor_public_uint64_vec) \
+    X(popcount_uint8_vec) \
+    X(popcount_uint16_vec) \
+    X(popcount_uint32_vec) \
+    X(popcount_uint64_vec) \
+    X(bit_extract_uint8_vec) \
+    X(bit_extract_uint16_vec) \
+    X(bit_extract_uint32_vec) \
+    X(bit_extract_uint64_vec)
+
+namespace sharemind {
+
+/**
+ * Compile-time identifiers of the named syscalls.
+ */
+enum class SyscallId : std::size_t {
+#define SPDZ_FRESCO_EMU_SYSCALL_ID(name) name,
+    SPDZ_FRESCO_EMU_SYSCALLS(SPDZ_FRESCO_EMU_SYSCALL_ID)
+#undef SPDZ_FRESCO_EMU_SYSCALL_ID
+};
+
+static constexpr std::size_t NUM_SYSCALLS = 0u
+#define SPDZ_FRESCO_EMU_SYSCALL_COUNT(name) + 1u
+    SPDZ_FRESCO_EMU_SYSCALLS(SPDZ_FRESCO_EMU_SYSCALL_COUNT)
+#undef SPDZ_FRESCO_EMU_SYSCALL_COUNT
+    ;
+
+/**
+ * \returns the fully qualified name of the syscall, e.g.
+ *          "spdz_fresco::new_uint32_vec".
+ */
+inline const char * syscallName(SyscallId id) noexcept {
+    static const char * const names[] = {
+#define SPDZ_FRESCO_EMU_SYSCALL_NAME(name) "spdz_fresco::" #name,
+        SPDZ_FRESCO_EMU_SYSCALLS(SPDZ_FRESCO_EMU_SYSCALL_NAME)
+#undef SPDZ_FRESCO_EMU_SYSCALL_NAME
+    };
+    return names[static_cast<std::size_t>(id)];
+}
+
+} /* namespace sharemind */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_SYSCALLS_SYSCALLIDS_H */
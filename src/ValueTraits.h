@@ -31,8 +31,16 @@ namespace sharemind {
 /*
  * Hierarchy of types.
  */
+struct SHAREMIND_VISIBILITY_INTERNAL bool_value_tag : public any_value_tag { };
 struct SHAREMIND_VISIBILITY_INTERNAL numeric_value_tag : public any_value_tag { };
 struct SHAREMIND_VISIBILITY_INTERNAL unsigned_value_tag : public numeric_value_tag { };
+struct SHAREMIND_VISIBILITY_INTERNAL signed_value_tag : public numeric_value_tag { };
+struct SHAREMIND_VISIBILITY_INTERNAL fixed_value_tag : public numeric_value_tag { };
+
+template <typename T>
+struct SHAREMIND_VISIBILITY_INTERNAL is_bool_value_tag :
+    std::is_base_of<bool_value_tag, typename ValueTraits<T>::value_category>
+{ };
 
 template <typename T>
 struct SHAREMIND_VISIBILITY_INTERNAL is_unsigned_value_tag :
@@ -44,6 +52,36 @@ struct SHAREMIND_VISIBILITY_INTERNAL is_integral_value_tag :
     std::is_base_of<numeric_value_tag, typename ValueTraits<T>::value_category>
 { };
 
+/**
+ * Booleans are stored as one 0/1 byte per element.
+ */
+struct SHAREMIND_VISIBILITY_INTERNAL sf_bool_t {
+    using value_category = bool_value_tag;
+    using share_type = uint8_t;
+    using public_type = bool;
+    static constexpr uint8_t heap_type_id = 0x3u;
+    static constexpr size_t num_of_bits = 1u;
+    static constexpr size_t log_of_bits = 0u;
+};
+
+struct SHAREMIND_VISIBILITY_INTERNAL sf_uint8_t {
+    using value_category = unsigned_value_tag;
+    using share_type = uint8_t;
+    using public_type = uint8_t;
+    static constexpr uint8_t heap_type_id = 0x6u;
+    static constexpr size_t num_of_bits = 8u;
+    static constexpr size_t log_of_bits = 3u;
+};
+
+struct SHAREMIND_VISIBILITY_INTERNAL sf_uint16_t {
+    using value_category = unsigned_value_tag;
+    using share_type = uint16_t;
+    using public_type = uint16_t;
+    static constexpr uint8_t heap_type_id = 0x7u;
+    static constexpr size_t num_of_bits = 16u;
+    static constexpr size_t log_of_bits = 4u;
+};
+
 struct SHAREMIND_VISIBILITY_INTERNAL sf_uint32_t {
     using value_category = unsigned_value_tag;
     using share_type = uint32_t;
@@ -62,6 +100,42 @@ struct SHAREMIND_VISIBILITY_INTERNAL sf_uint64_t {
     static constexpr size_t log_of_bits = 6u;
 };
 
+/**
+ * Signed integers are stored in two's complement and wrap around on
+ * overflow like the unsigned ones.
+ */
+struct SHAREMIND_VISIBILITY_INTERNAL sf_int32_t {
+    using value_category = signed_value_tag;
+    using share_type = int32_t;
+    using public_type = int32_t;
+    static constexpr uint8_t heap_type_id = 0x4u;
+    static constexpr size_t num_of_bits = 32u;
+    static constexpr size_t log_of_bits = 5u;
+};
+
+struct SHAREMIND_VISIBILITY_INTERNAL sf_int64_t {
+    using value_category = signed_value_tag;
+    using share_type = int64_t;
+    using public_type = int64_t;
+    static constexpr uint8_t heap_type_id = 0x5u;
+    static constexpr size_t num_of_bits = 64u;
+    static constexpr size_t log_of_bits = 6u;
+};
+
+/**
+ * Fixed-point numbers are stored as 64-bit two's complement integers scaled
+ * by 2^f, where f is the FixedPoint.FractionalBits option of the protection
+ * domain. The public values are in the same representation.
+ */
+struct SHAREMIND_VISIBILITY_INTERNAL sf_fix64_t {
+    using value_category = fixed_value_tag;
+    using share_type = int64_t;
+    using public_type = int64_t;
+    static constexpr uint8_t heap_type_id = 0x8u;
+    static constexpr size_t num_of_bits = 64u;
+    static constexpr size_t log_of_bits = 6u;
+};
+
 } /* namespace sharemind */
 
 #endif /* MOD_SPDZ_FRESCO_EMU_VALUETRAITS_H */
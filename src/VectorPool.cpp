@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include "VectorPool.h"
+
+
+namespace sharemind {
+
+VectorPool::VectorPool(std::size_t maxVectorSize, std::size_t maxPooledBytes)
+    : m_maxVectorSize(maxVectorSize)
+    , m_maxPooledBytes(maxPooledBytes)
+{}
+
+VectorPool::~VectorPool() noexcept {
+    for (const std::unique_ptr<TypePool> & pool : m_typePools) {
+        if (!pool)
+            continue;
+        for (const std::vector<void *> & freeList : pool->freeLists)
+            for (void * const vec : freeList)
+                pool->destroy(vec);
+    }
+}
+
+void VectorPool::recycle(uint8_t heapTypeId,
+                         void * vec,
+                         std::size_t capacity) noexcept
+{
+    /* Only vectors with exactly the capacity of their size class are kept, so
+       that the pooled bytes account for all of the pooled storage. Vectors
+       allocated with an exact capacity above the maximum vector size are
+       freed: */
+    const std::size_t sizeClass = sizeClassOf(capacity);
+    TypePool & pool = *m_typePools[heapTypeId];
+    if (sizeClass >= NUM_SIZE_CLASSES
+        || (std::size_t(1u) << sizeClass) != capacity
+        || sizeClass > sizeClassOf(m_maxVectorSize))
+    {
+        pool.destroy(vec);
+        return;
+    }
+
+    const std::size_t bytes = pool.elementSize << sizeClass;
+    if (m_statistics.pooledBytes + bytes > m_maxPooledBytes) {
+        pool.destroy(vec);
+        return;
+    }
+
+    std::vector<void *> & freeList = pool.freeLists[sizeClass];
+    try {
+        freeList.push_back(vec);
+    } catch (...) {
+        pool.destroy(vec);
+        return;
+    }
+
+    m_statistics.pooledBytes += bytes;
+    if (m_statistics.pooledBytes > m_statistics.peakPooledBytes)
+        m_statistics.peakPooledBytes = m_statistics.pooledBytes;
+}
+
+} /* namespace sharemind { */
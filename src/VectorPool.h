@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_VECTORPOOL_H
+#define MOD_SPDZ_FRESCO_EMU_VECTORPOOL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sharemind/ShareVector.h>
+#include <sharemind/visibility.h>
+#include <unordered_map>
+#include <vector>
+#include "ValueTraits.h"
+
+
+namespace sharemind {
+
+/**
+ * Recycles share vectors and their storage. Vectors up to a configurable
+ * size are allocated with a capacity rounded up to the next power of two
+ * and are kept in per-type size class free lists after they are released,
+ * as long as the total size of the pooled storage stays under the
+ * configured limit. The capacities of resized vectors are tracked, so that
+ * they can grow geometrically and are recycled by their capacity.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL VectorPool {
+
+public: /* Types: */
+
+    struct Statistics {
+        std::size_t liveVectors = 0u;
+        std::size_t peakLiveVectors = 0u;
+        std::size_t pooledBytes = 0u;
+        std::size_t peakPooledBytes = 0u;
+        uint64_t reusedVectors = 0u;
+        uint64_t allocatedVectors = 0u;
+    };
+
+private: /* Types: */
+
+    static constexpr std::size_t NUM_SIZE_CLASSES = 64u;
+
+    struct TypePool {
+        void (* destroy)(void * vec) noexcept;
+        std::size_t elementSize;
+        std::array<std::vector<void *>, NUM_SIZE_CLASSES> freeLists;
+    };
+
+public: /* Methods: */
+
+    VectorPool(std::size_t maxVectorSize, std::size_t maxPooledBytes);
+    ~VectorPool() noexcept;
+
+    VectorPool(const VectorPool &) = delete;
+    VectorPool & operator=(const VectorPool &) = delete;
+
+    /** \returns a zero-initialized vector of the given size. */
+    template <typename T>
+    ShareVec<T> * acquire(std::size_t size) {
+        using share_type = typename ValueTraits<T>::share_type;
+
+        ShareVec<T> * vec;
+        if (size > m_maxVectorSize) {
+            vec = new ShareVec<T>(size);
+            ++m_statistics.allocatedVectors;
+        } else {
+            const std::size_t sizeClass = sizeClassOf(size);
+            std::vector<void *> & freeList =
+                typePool<T>().freeLists[sizeClass];
+            if (!freeList.empty()) {
+                vec = static_cast<ShareVec<T> *>(freeList.back());
+                freeList.pop_back();
+                m_statistics.pooledBytes -=
+                    sizeof(share_type) << sizeClass;
+                vec->resize(0u);
+                vec->resize(size);
+                ++m_statistics.reusedVectors;
+            } else {
+                vec = new ShareVec<T>(std::size_t(1u) << sizeClass);
+                vec->resize(size);
+                ++m_statistics.allocatedVectors;
+            }
+        }
+
+        if (++m_statistics.liveVectors > m_statistics.peakLiveVectors)
+            m_statistics.peakLiveVectors = m_statistics.liveVectors;
+        return vec;
+    }
+
+    /** Returns a vector acquired from this pool back to the pool. */
+    template <typename T>
+    void release(ShareVec<T> * vec) noexcept {
+        --m_statistics.liveVectors;
+        const std::size_t capacity = capacityOf(vec, vec->size());
+        m_capacities.erase(vec);
+        recycle(T::heap_type_id, vec, capacity);
+    }
+
+    /**
+     * \brief Frees a vector acquired from this pool given only its heap type.
+     * \pre The vector was acquired from this pool as the given type.
+     */
+    void destroy(uint8_t heapTypeId, void * vec) noexcept {
+        --m_statistics.liveVectors;
+        m_capacities.erase(vec);
+        m_typePools[heapTypeId]->destroy(vec);
+    }
+
+    /**
+     * \brief Resizes a vector acquired from this pool, new elements are zero.
+     * \details Growing a vector beyond its capacity at least doubles the
+     *          capacity, so growing a vector one element at a time takes
+     *          amortized constant time per element.
+     */
+    template <typename T>
+    void resize(ShareVec<T> & vec, std::size_t size) {
+        std::size_t & capacity =
+            m_capacities.emplace(&vec, capacityOf(&vec, vec.size()))
+                .first->second;
+        if (size > capacity) {
+            const std::size_t newCapacity =
+                std::size_t(1u) << sizeClassOf(std::max(size, 2u * capacity));
+            grow(vec, newCapacity);
+            capacity = newCapacity;
+        }
+        vec.resize(size);
+    }
+
+    /**
+     * \brief Makes sure that a vector acquired from this pool can be resized
+     *        up to the given capacity without reallocating.
+     * \details Like resize(), rounds the capacity up to a whole size class.
+     */
+    template <typename T>
+    void reserve(ShareVec<T> & vec, std::size_t capacity) {
+        std::size_t & current =
+            m_capacities.emplace(&vec, capacityOf(&vec, vec.size()))
+                .first->second;
+        if (capacity > current) {
+            const std::size_t newCapacity =
+                std::size_t(1u) << sizeClassOf(capacity);
+            grow(vec, newCapacity);
+            current = newCapacity;
+        }
+    }
+
+    inline const Statistics & statistics() const noexcept
+    { return m_statistics; }
+
+private:
+
+    static inline std::size_t sizeClassOf(std::size_t size) noexcept {
+        std::size_t sizeClass = 0u;
+        while ((std::size_t(1u) << sizeClass) < size)
+            ++sizeClass;
+        return sizeClass;
+    }
+
+    /** \returns a lower bound of the capacity of a vector of this pool. */
+    inline std::size_t capacityOf(const void * vec, std::size_t size)
+            const noexcept
+    {
+        const auto it = m_capacities.find(vec);
+        if (it != m_capacities.end())
+            return it->second;
+        return (size > m_maxVectorSize)
+               ? size
+               : (std::size_t(1u) << sizeClassOf(size));
+    }
+
+    template <typename T>
+    static void grow(ShareVec<T> & vec, std::size_t capacity) {
+        // Shrinking a vector keeps its storage:
+        const std::size_t size = vec.size();
+        vec.resize(capacity);
+        vec.resize(size);
+    }
+
+    template <typename T>
+    TypePool & typePool() {
+        std::unique_ptr<TypePool> & pool = m_typePools[T::heap_type_id];
+        if (!pool) {
+            pool.reset(new TypePool());
+            pool->destroy = &destroyVector<T>;
+            pool->elementSize = sizeof(typename ValueTraits<T>::share_type);
+        }
+        return *pool;
+    }
+
+    template <typename T>
+    static void destroyVector(void * vec) noexcept
+    { delete static_cast<ShareVec<T> *>(vec); }
+
+    void recycle(uint8_t heapTypeId, void * vec, std::size_t capacity)
+            noexcept;
+
+private: /* Fields: */
+
+    const std::size_t m_maxVectorSize;
+    const std::size_t m_maxPooledBytes;
+    std::array<std::unique_ptr<TypePool>, 256u> m_typePools;
+    std::unordered_map<const void *, std::size_t> m_capacities;
+    Statistics m_statistics;
+
+}; /* class VectorPool { */
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_VECTORPOOL_H */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#include "WorkerPool.h"
+
+
+namespace sharemind {
+
+WorkerPool::WorkerPool(std::size_t numThreads, std::size_t minChunkSize)
+    : m_minChunkSize(minChunkSize > 0u ? minChunkSize : 1u)
+{
+    if (numThreads == 0u)
+        numThreads = std::thread::hardware_concurrency();
+
+    try {
+        for (std::size_t i = 1u; i < numThreads; ++i)
+            m_workers.emplace_back(&WorkerPool::workerLoop, this);
+    } catch (...) {
+        stopWorkers();
+        throw;
+    }
+}
+
+WorkerPool::~WorkerPool() noexcept { stopWorkers(); }
+
+void WorkerPool::stopWorkers() noexcept {
+    {
+        std::lock_guard<std::mutex> const guard(m_mutex);
+        m_stop = true;
+    }
+    m_jobsAvailable.notify_all();
+    for (std::thread & worker : m_workers)
+        worker.join();
+    m_workers.clear();
+}
+
+void WorkerPool::run(void (* run)(void *, std::size_t, std::size_t),
+                     void * context,
+                     std::size_t size,
+                     std::size_t numChunks)
+{
+    Job job;
+    job.run = run;
+    job.context = context;
+    job.size = size;
+    job.chunkSize = size / numChunks;
+    job.numChunks = numChunks;
+    job.nextChunk = 0u;
+    job.finishedChunks = 0u;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_jobs.push_back(&job);
+    m_jobsAvailable.notify_all();
+
+    while (job.nextChunk < job.numChunks)
+        runNextChunk(lock, job);
+    job.finished.wait(lock,
+                      [&job] { return job.finishedChunks == job.numChunks; });
+
+    if (job.exception)
+        std::rethrow_exception(job.exception);
+}
+
+void WorkerPool::runNextChunk(std::unique_lock<std::mutex> & lock, Job & job)
+        noexcept
+{
+    const std::size_t chunk = job.nextChunk++;
+    if (job.nextChunk == job.numChunks) {
+        for (auto it = m_jobs.begin(); it != m_jobs.end(); ++it) {
+            if (*it == &job) {
+                m_jobs.erase(it);
+                break;
+            }
+        }
+    }
+
+    // The last chunk also covers the remainder of the range:
+    const std::size_t begin = chunk * job.chunkSize;
+    const std::size_t end = chunk + 1u == job.numChunks
+                            ? job.size
+                            : begin + job.chunkSize;
+
+    lock.unlock();
+    std::exception_ptr exception;
+    try {
+        job.run(job.context, begin, end);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    lock.lock();
+
+    if (exception && !job.exception)
+        job.exception = exception;
+    if (++job.finishedChunks == job.numChunks)
+        job.finished.notify_all();
+}
+
+void WorkerPool::workerLoop() noexcept {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_jobsAvailable.wait(lock,
+                             [this] { return m_stop || !m_jobs.empty(); });
+        if (m_stop)
+            return;
+        runNextChunk(lock, *m_jobs.front());
+    }
+}
+
+} /* namespace sharemind { */
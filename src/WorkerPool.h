@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2015 Cybernetica
+ *
+ * Research/Commercial License Usage
+ * Licensees holding a valid Research License or Commercial License
+ * for the Software may use this file according to the written
+ * agreement between you and Cybernetica.
+ *
+ * GNU General Public License Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl-3.0.html.
+ *
+ * For further information, please contact us at sharemind@cyber.ee.
+ */
+
+#ifndef MOD_SPDZ_FRESCO_EMU_WORKERPOOL_H
+#define MOD_SPDZ_FRESCO_EMU_WORKERPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <sharemind/visibility.h>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+namespace sharemind {
+
+/**
+ * Pool of worker threads for splitting large vector operations into chunks.
+ * The pool may be used concurrently by several processes. The calling
+ * thread always takes part in executing its own chunks.
+ */
+class SHAREMIND_VISIBILITY_INTERNAL WorkerPool {
+
+private: /* Types: */
+
+    struct Job {
+        void (* run)(void * context, std::size_t begin, std::size_t end);
+        void * context;
+        std::size_t size;
+        std::size_t chunkSize;
+        std::size_t numChunks;
+        std::size_t nextChunk;
+        std::size_t finishedChunks;
+        std::exception_ptr exception;
+        std::condition_variable finished;
+    };
+
+public: /* Methods: */
+
+    /**
+     * \param[in] numThreads the total number of threads to use, including
+     *                       the calling thread.
+     * \param[in] minChunkSize the minimum number of elements per chunk.
+     */
+    WorkerPool(std::size_t numThreads, std::size_t minChunkSize);
+    ~WorkerPool() noexcept;
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool & operator=(const WorkerPool &) = delete;
+
+    /**
+     * \brief Calls f(begin, end) for consecutive chunks covering [0, size).
+     * \details Small ranges are processed inline in a single call. If any
+     *          of the calls throws, one of the exceptions is rethrown after
+     *          all chunks have finished.
+     */
+    template <typename F>
+    void parallelFor(std::size_t size, F && f) {
+        const std::size_t numChunks = this->numChunks(size);
+        if (numChunks <= 1u) {
+            f(std::size_t(0u), size);
+            return;
+        }
+
+        using Fn = typename std::remove_reference<F>::type;
+        run(&runChunk<Fn>, const_cast<void *>(static_cast<const void *>(&f)),
+            size,
+            numChunks);
+    }
+
+private:
+
+    inline std::size_t numChunks(std::size_t size) const noexcept {
+        if (m_workers.empty())
+            return 1u;
+        const std::size_t n = size / m_minChunkSize;
+        const std::size_t maxChunks = m_workers.size() + 1u;
+        return n < maxChunks ? n : maxChunks;
+    }
+
+    template <typename Fn>
+    static void runChunk(void * context, std::size_t begin, std::size_t end)
+    { (*static_cast<Fn *>(context))(begin, end); }
+
+    void run(void (* run)(void *, std::size_t, std::size_t),
+             void * context,
+             std::size_t size,
+             std::size_t numChunks);
+
+    /**
+     * \pre The mutex is locked and the job has unclaimed chunks.
+     * \post The mutex is locked.
+     */
+    void runNextChunk(std::unique_lock<std::mutex> & lock, Job & job)
+            noexcept;
+
+    void stopWorkers() noexcept;
+    void workerLoop() noexcept;
+
+private: /* Fields: */
+
+    const std::size_t m_minChunkSize;
+    std::mutex m_mutex;
+    std::condition_variable m_jobsAvailable;
+    std::deque<Job *> m_jobs;
+    bool m_stop = false;
+    std::vector<std::thread> m_workers;
+
+}; /* class WorkerPool { */
+
+} /* namespace sharemind { */
+
+#endif /* MOD_SPDZ_FRESCO_EMU_WORKERPOOL_H */
@@ -128,22 +128,109 @@ NAMED_SYSCALL_WRAPPER(assign_uint32_vec, assign_vec<sf_uint32_t>)
 NAMED_SYSCALL_WRAPPER(assign_uint64_vec, assign_vec<sf_uint64_t>)
 NAMED_SYSCALL_WRAPPER(delete_uint32_vec, delete_vec<sf_uint32_t>)
 NAMED_SYSCALL_WRAPPER(delete_uint64_vec, delete_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(resize_uint32_vec, resize_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(resize_uint64_vec, resize_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(reserve_uint32_vec, reserve_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(reserve_uint64_vec, reserve_vec<sf_uint64_t>)
 NAMED_SYSCALL_WRAPPER(load_uint32_vec, load_vec<sf_uint32_t>)
 NAMED_SYSCALL_WRAPPER(load_uint64_vec, load_vec<sf_uint64_t>)
 NAMED_SYSCALL_WRAPPER(store_uint32_vec, store_vec<sf_uint32_t>)
 NAMED_SYSCALL_WRAPPER(store_uint64_vec, store_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(gather_uint32_vec, gather_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(gather_uint64_vec, gather_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(scatter_uint32_vec, scatter_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(scatter_uint64_vec, scatter_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(slice_uint32_vec, slice_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(slice_uint64_vec, slice_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(concat_uint32_vec, concat_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(concat_uint64_vec, concat_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(copy_range_uint32_vec, copy_range_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(copy_range_uint64_vec, copy_range_vec<sf_uint64_t>)
 NAMED_SYSCALL_WRAPPER(classify_uint32_vec, classify_vec<sf_uint32_t>)
 NAMED_SYSCALL_WRAPPER(classify_uint64_vec, classify_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(classify_file_uint32_vec, classify_file_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(classify_file_uint64_vec, classify_file_vec<sf_uint64_t>)
 NAMED_SYSCALL_WRAPPER(declassify_uint32_vec, declassify_vec<sf_uint32_t>)
 NAMED_SYSCALL_WRAPPER(declassify_uint64_vec, declassify_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(declassify_file_uint32_vec, declassify_file_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(declassify_file_uint64_vec, declassify_file_vec<sf_uint64_t>)
 NAMED_SYSCALL_WRAPPER(get_type_size_uint32, get_type_size<sf_uint32_t>)
 NAMED_SYSCALL_WRAPPER(get_type_size_uint64, get_type_size<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(new_bool_vec, new_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(delete_bool_vec, delete_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(resize_bool_vec, resize_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(reserve_bool_vec, reserve_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(get_shares_bool_vec, get_shares<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(declassify_bool_vec, declassify_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(declassify_file_bool_vec, declassify_file_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(get_type_size_bool, get_type_size<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(init_bool_vec, init_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(set_shares_bool_vec, set_shares<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(fill_bool_vec, fill_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(assign_bool_vec, assign_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(load_bool_vec, load_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(store_bool_vec, store_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(gather_bool_vec, gather_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(scatter_bool_vec, scatter_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(slice_bool_vec, slice_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(concat_bool_vec, concat_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(copy_range_bool_vec, copy_range_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(classify_bool_vec, classify_vec<sf_bool_t>)
+NAMED_SYSCALL_WRAPPER(classify_file_bool_vec, classify_file_vec<sf_bool_t>)
 NAMED_SYSCALL_WRAPPER(add_uint32_vec, binary_arith_vec<sf_uint32_t, AdditionProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(add_uint64_vec, binary_arith_vec<sf_uint64_t, AdditionProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(sub_uint32_vec, binary_arith_vec<sf_uint32_t, SubtractionProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(sub_uint64_vec, binary_arith_vec<sf_uint64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(mul_uint32_vec, binary_arith_vec<sf_uint32_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(mul_uint64_vec, binary_arith_vec<sf_uint64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(div_uint32_vec, binary_arith_vec<sf_uint32_t, IntegerDivisionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(div_uint64_vec, binary_arith_vec<sf_uint64_t, IntegerDivisionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mod_uint32_vec, binary_arith_vec<sf_uint32_t, IntegerRemainderProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mod_uint64_vec, binary_arith_vec<sf_uint64_t, IntegerRemainderProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shl_uint32_vec, binary_arith_vec<sf_uint32_t, ShiftLeftProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shl_uint64_vec, binary_arith_vec<sf_uint64_t, ShiftLeftProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shr_uint32_vec, binary_arith_vec<sf_uint32_t, ShiftRightProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shr_uint64_vec, binary_arith_vec<sf_uint64_t, ShiftRightProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(div_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, IntegerDivisionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(div_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, IntegerDivisionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mod_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, IntegerRemainderProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mod_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, IntegerRemainderProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shl_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, ShiftLeftProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shl_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, ShiftLeftProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shr_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, ShiftRightProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shr_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, ShiftRightProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_uint32_vec, binary_assign_vec<sf_uint32_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_uint64_vec, binary_assign_vec<sf_uint64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_uint32_vec, binary_assign_vec<sf_uint32_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_uint64_vec, binary_assign_vec<sf_uint64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_uint32_vec, binary_assign_vec<sf_uint32_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_uint64_vec, binary_assign_vec<sf_uint64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_public_uint32_vec, binary_assign_public_vec<sf_uint32_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_public_uint64_vec, binary_assign_public_vec<sf_uint64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_public_uint32_vec, binary_assign_public_vec<sf_uint32_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_public_uint64_vec, binary_assign_public_vec<sf_uint64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_public_uint32_vec, binary_assign_public_vec<sf_uint32_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_public_uint64_vec, binary_assign_public_vec<sf_uint64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(fma_uint32_vec, ternary_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, sf_uint32_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(fma_uint64_vec, ternary_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, sf_uint64_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_add_public_uint32_vec, ternary_public_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, sf_uint32_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_add_public_uint64_vec, ternary_public_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, sf_uint64_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sum_uint32_vec, unary_vec<sf_uint32_t, sf_uint32_t, SumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sum_uint64_vec, unary_vec<sf_uint64_t, sf_uint64_t, SumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(product_uint32_vec, unary_vec<sf_uint32_t, sf_uint32_t, ProductProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(product_uint64_vec, unary_vec<sf_uint64_t, sf_uint64_t, ProductProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(min_uint32_vec, unary_vec<sf_uint32_t, sf_uint32_t, MinimumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(min_uint64_vec, unary_vec<sf_uint64_t, sf_uint64_t, MinimumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(max_uint32_vec, unary_vec<sf_uint32_t, sf_uint32_t, MaximumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(max_uint64_vec, unary_vec<sf_uint64_t, sf_uint64_t, MaximumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(prefix_sum_uint32_vec, unary_vec<sf_uint32_t, sf_uint32_t, PrefixSumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(prefix_sum_uint64_vec, unary_vec<sf_uint64_t, sf_uint64_t, PrefixSumProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(eq_uint32_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, EqualityProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(eq_uint64_vec, binary_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, EqualityProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(gt_uint32_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
@@ -154,10 +241,411 @@ NAMED_SYSCALL_WRAPPER(lt_uint32_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_uin
 NAMED_SYSCALL_WRAPPER(lt_uint64_vec, binary_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, LessThanProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(lte_uint32_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(lte_uint64_vec, binary_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_uint32_to_bool_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_uint64_to_bool_vec, binary_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_uint32_to_bool_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_uint64_to_bool_vec, binary_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_uint32_to_bool_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_uint64_to_bool_vec, binary_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_uint32_to_bool_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_uint64_to_bool_vec, binary_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_uint32_to_bool_vec, binary_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_uint64_to_bool_vec, binary_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_uint32_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_uint64_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_uint32_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_uint64_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_uint32_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_uint64_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_uint32_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_uint64_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_uint32_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_uint64_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_uint32_to_bool_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_uint64_to_bool_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_uint32_to_bool_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_uint64_to_bool_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_uint32_to_bool_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_uint64_to_bool_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_uint32_to_bool_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_uint64_to_bool_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_uint32_to_bool_vec, binary_public_vec<sf_uint32_t, sf_uint32_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_uint64_to_bool_vec, binary_public_vec<sf_uint64_t, sf_uint64_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(conv_uint64_to_uint32_vec, unary_vec<sf_uint64_t, sf_uint32_t, ConversionProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(conv_uint32_to_uint64_vec, unary_vec<sf_uint32_t, sf_uint64_t, ConversionProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(choose_uint32_vec, ternary_vec<sf_uint32_t, sf_uint32_t, sf_uint32_t, sf_uint32_t, ObliviousChoiceProtocol<SpdzFrescoPDPI>>)
 NAMED_SYSCALL_WRAPPER(choose_uint64_vec, ternary_vec<sf_uint64_t, sf_uint64_t, sf_uint64_t, sf_uint64_t, ObliviousChoiceProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shuffle_uint32_vec, shuffle_vec<sf_uint32_t>)
+NAMED_SYSCALL_WRAPPER(sort_uint32_vec, unary_vec<sf_uint32_t, sf_uint32_t, SortProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sort_by_key_uint32_vec, binary_arith_vec<sf_uint32_t, SortByKeyProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shuffle_uint64_vec, shuffle_vec<sf_uint64_t>)
+NAMED_SYSCALL_WRAPPER(sort_uint64_vec, unary_vec<sf_uint64_t, sf_uint64_t, SortProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sort_by_key_uint64_vec, binary_arith_vec<sf_uint64_t, SortByKeyProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(new_int32_vec, new_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(new_int64_vec, new_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(init_int32_vec, init_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(init_int64_vec, init_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(set_shares_int32_vec, set_shares<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(set_shares_int64_vec, set_shares<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(get_shares_int32_vec, get_shares<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(get_shares_int64_vec, get_shares<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(fill_int32_vec, fill_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(fill_int64_vec, fill_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(assign_int32_vec, assign_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(assign_int64_vec, assign_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(delete_int32_vec, delete_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(delete_int64_vec, delete_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(resize_int32_vec, resize_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(resize_int64_vec, resize_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(reserve_int32_vec, reserve_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(reserve_int64_vec, reserve_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(load_int32_vec, load_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(load_int64_vec, load_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(store_int32_vec, store_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(store_int64_vec, store_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(gather_int32_vec, gather_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(gather_int64_vec, gather_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(scatter_int32_vec, scatter_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(scatter_int64_vec, scatter_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(slice_int32_vec, slice_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(slice_int64_vec, slice_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(concat_int32_vec, concat_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(concat_int64_vec, concat_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(copy_range_int32_vec, copy_range_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(copy_range_int64_vec, copy_range_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(classify_int32_vec, classify_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(classify_int64_vec, classify_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(classify_file_int32_vec, classify_file_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(classify_file_int64_vec, classify_file_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(declassify_int32_vec, declassify_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(declassify_int64_vec, declassify_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(declassify_file_int32_vec, declassify_file_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(declassify_file_int64_vec, declassify_file_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(get_type_size_int32, get_type_size<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(get_type_size_int64, get_type_size<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(add_int32_vec, binary_arith_vec<sf_int32_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_int64_vec, binary_arith_vec<sf_int64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_int32_vec, binary_arith_vec<sf_int32_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_int64_vec, binary_arith_vec<sf_int64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_int32_vec, binary_arith_vec<sf_int32_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_int64_vec, binary_arith_vec<sf_int64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_public_int32_vec, binary_arith_public_vec<sf_int32_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_public_int64_vec, binary_arith_public_vec<sf_int64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_public_int32_vec, binary_arith_public_vec<sf_int32_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_public_int64_vec, binary_arith_public_vec<sf_int64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_public_int32_vec, binary_arith_public_vec<sf_int32_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_public_int64_vec, binary_arith_public_vec<sf_int64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_int32_vec, binary_assign_vec<sf_int32_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_int64_vec, binary_assign_vec<sf_int64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_int32_vec, binary_assign_vec<sf_int32_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_int64_vec, binary_assign_vec<sf_int64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_int32_vec, binary_assign_vec<sf_int32_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_int64_vec, binary_assign_vec<sf_int64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_public_int32_vec, binary_assign_public_vec<sf_int32_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_public_int64_vec, binary_assign_public_vec<sf_int64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_public_int32_vec, binary_assign_public_vec<sf_int32_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_public_int64_vec, binary_assign_public_vec<sf_int64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_public_int32_vec, binary_assign_public_vec<sf_int32_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_public_int64_vec, binary_assign_public_vec<sf_int64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(fma_int32_vec, ternary_vec<sf_int32_t, sf_int32_t, sf_int32_t, sf_int32_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(fma_int64_vec, ternary_vec<sf_int64_t, sf_int64_t, sf_int64_t, sf_int64_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_add_public_int32_vec, ternary_public_vec<sf_int32_t, sf_int32_t, sf_int32_t, sf_int32_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_add_public_int64_vec, ternary_public_vec<sf_int64_t, sf_int64_t, sf_int64_t, sf_int64_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sum_int32_vec, unary_vec<sf_int32_t, sf_int32_t, SumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sum_int64_vec, unary_vec<sf_int64_t, sf_int64_t, SumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(product_int32_vec, unary_vec<sf_int32_t, sf_int32_t, ProductProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(product_int64_vec, unary_vec<sf_int64_t, sf_int64_t, ProductProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(min_int32_vec, unary_vec<sf_int32_t, sf_int32_t, MinimumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(min_int64_vec, unary_vec<sf_int64_t, sf_int64_t, MinimumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(max_int32_vec, unary_vec<sf_int32_t, sf_int32_t, MaximumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(max_int64_vec, unary_vec<sf_int64_t, sf_int64_t, MaximumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(prefix_sum_int32_vec, unary_vec<sf_int32_t, sf_int32_t, PrefixSumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(prefix_sum_int64_vec, unary_vec<sf_int64_t, sf_int64_t, PrefixSumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_int32_vec, binary_vec<sf_int32_t, sf_int32_t, sf_int32_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_int64_vec, binary_vec<sf_int64_t, sf_int64_t, sf_int64_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_int32_vec, binary_vec<sf_int32_t, sf_int32_t, sf_int32_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_int64_vec, binary_vec<sf_int64_t, sf_int64_t, sf_int64_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_int32_vec, binary_vec<sf_int32_t, sf_int32_t, sf_int32_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_int64_vec, binary_vec<sf_int64_t, sf_int64_t, sf_int64_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_int32_vec, binary_vec<sf_int32_t, sf_int32_t, sf_int32_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_int64_vec, binary_vec<sf_int64_t, sf_int64_t, sf_int64_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_int32_vec, binary_vec<sf_int32_t, sf_int32_t, sf_int32_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_int64_vec, binary_vec<sf_int64_t, sf_int64_t, sf_int64_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_int32_to_bool_vec, binary_vec<sf_int32_t, sf_int32_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_int64_to_bool_vec, binary_vec<sf_int64_t, sf_int64_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_int32_to_bool_vec, binary_vec<sf_int32_t, sf_int32_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_int64_to_bool_vec, binary_vec<sf_int64_t, sf_int64_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_int32_to_bool_vec, binary_vec<sf_int32_t, sf_int32_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_int64_to_bool_vec, binary_vec<sf_int64_t, sf_int64_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_int32_to_bool_vec, binary_vec<sf_int32_t, sf_int32_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_int64_to_bool_vec, binary_vec<sf_int64_t, sf_int64_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_int32_to_bool_vec, binary_vec<sf_int32_t, sf_int32_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_int64_to_bool_vec, binary_vec<sf_int64_t, sf_int64_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_int32_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_int32_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_int64_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_int64_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_int32_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_int32_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_int64_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_int64_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_int32_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_int32_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_int64_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_int64_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_int32_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_int32_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_int64_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_int64_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_int32_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_int32_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_int64_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_int64_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_int32_to_bool_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_int64_to_bool_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_int32_to_bool_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_int64_to_bool_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_int32_to_bool_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_int64_to_bool_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_int32_to_bool_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_int64_to_bool_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_int32_to_bool_vec, binary_public_vec<sf_int32_t, sf_int32_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_int64_to_bool_vec, binary_public_vec<sf_int64_t, sf_int64_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_int64_to_int32_vec, unary_vec<sf_int64_t, sf_int32_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_int32_to_int64_vec, unary_vec<sf_int32_t, sf_int64_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_int32_to_uint32_vec, unary_vec<sf_int32_t, sf_uint32_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint32_to_int32_vec, unary_vec<sf_uint32_t, sf_int32_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_int64_to_uint64_vec, unary_vec<sf_int64_t, sf_uint64_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint64_to_int64_vec, unary_vec<sf_uint64_t, sf_int64_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(choose_int32_vec, ternary_vec<sf_int32_t, sf_int32_t, sf_int32_t, sf_int32_t, ObliviousChoiceProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(choose_int64_vec, ternary_vec<sf_int64_t, sf_int64_t, sf_int64_t, sf_int64_t, ObliviousChoiceProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shuffle_int32_vec, shuffle_vec<sf_int32_t>)
+NAMED_SYSCALL_WRAPPER(sort_int32_vec, unary_vec<sf_int32_t, sf_int32_t, SortProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sort_by_key_int32_vec, binary_arith_vec<sf_int32_t, SortByKeyProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shuffle_int64_vec, shuffle_vec<sf_int64_t>)
+NAMED_SYSCALL_WRAPPER(sort_int64_vec, unary_vec<sf_int64_t, sf_int64_t, SortProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sort_by_key_int64_vec, binary_arith_vec<sf_int64_t, SortByKeyProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(new_uint8_vec, new_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(new_uint16_vec, new_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(init_uint8_vec, init_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(init_uint16_vec, init_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(set_shares_uint8_vec, set_shares<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(set_shares_uint16_vec, set_shares<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(get_shares_uint8_vec, get_shares<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(get_shares_uint16_vec, get_shares<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(fill_uint8_vec, fill_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(fill_uint16_vec, fill_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(assign_uint8_vec, assign_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(assign_uint16_vec, assign_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(delete_uint8_vec, delete_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(delete_uint16_vec, delete_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(resize_uint8_vec, resize_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(resize_uint16_vec, resize_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(reserve_uint8_vec, reserve_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(reserve_uint16_vec, reserve_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(load_uint8_vec, load_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(load_uint16_vec, load_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(store_uint8_vec, store_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(store_uint16_vec, store_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(gather_uint8_vec, gather_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(gather_uint16_vec, gather_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(scatter_uint8_vec, scatter_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(scatter_uint16_vec, scatter_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(slice_uint8_vec, slice_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(slice_uint16_vec, slice_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(concat_uint8_vec, concat_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(concat_uint16_vec, concat_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(copy_range_uint8_vec, copy_range_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(copy_range_uint16_vec, copy_range_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(classify_uint8_vec, classify_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(classify_uint16_vec, classify_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(classify_file_uint8_vec, classify_file_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(classify_file_uint16_vec, classify_file_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(declassify_uint8_vec, declassify_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(declassify_uint16_vec, declassify_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(declassify_file_uint8_vec, declassify_file_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(declassify_file_uint16_vec, declassify_file_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(get_type_size_uint8, get_type_size<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(get_type_size_uint16, get_type_size<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(add_uint8_vec, binary_arith_vec<sf_uint8_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_uint16_vec, binary_arith_vec<sf_uint16_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_uint8_vec, binary_arith_vec<sf_uint8_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_uint16_vec, binary_arith_vec<sf_uint16_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_uint8_vec, binary_arith_vec<sf_uint8_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_uint16_vec, binary_arith_vec<sf_uint16_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_public_uint8_vec, binary_arith_public_vec<sf_uint8_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_public_uint16_vec, binary_arith_public_vec<sf_uint16_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_public_uint8_vec, binary_arith_public_vec<sf_uint8_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_public_uint16_vec, binary_arith_public_vec<sf_uint16_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_public_uint8_vec, binary_arith_public_vec<sf_uint8_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_public_uint16_vec, binary_arith_public_vec<sf_uint16_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_uint8_vec, binary_assign_vec<sf_uint8_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_uint16_vec, binary_assign_vec<sf_uint16_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_uint8_vec, binary_assign_vec<sf_uint8_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_uint16_vec, binary_assign_vec<sf_uint16_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_uint8_vec, binary_assign_vec<sf_uint8_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_uint16_vec, binary_assign_vec<sf_uint16_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_public_uint8_vec, binary_assign_public_vec<sf_uint8_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_assign_public_uint16_vec, binary_assign_public_vec<sf_uint16_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_public_uint8_vec, binary_assign_public_vec<sf_uint8_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_assign_public_uint16_vec, binary_assign_public_vec<sf_uint16_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_public_uint8_vec, binary_assign_public_vec<sf_uint8_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_assign_public_uint16_vec, binary_assign_public_vec<sf_uint16_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(fma_uint8_vec, ternary_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, sf_uint8_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(fma_uint16_vec, ternary_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, sf_uint16_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_add_public_uint8_vec, ternary_public_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, sf_uint8_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_add_public_uint16_vec, ternary_public_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, sf_uint16_t, FusedMultiplyAddProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sum_uint8_vec, unary_vec<sf_uint8_t, sf_uint8_t, SumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sum_uint16_vec, unary_vec<sf_uint16_t, sf_uint16_t, SumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(product_uint8_vec, unary_vec<sf_uint8_t, sf_uint8_t, ProductProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(product_uint16_vec, unary_vec<sf_uint16_t, sf_uint16_t, ProductProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(min_uint8_vec, unary_vec<sf_uint8_t, sf_uint8_t, MinimumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(min_uint16_vec, unary_vec<sf_uint16_t, sf_uint16_t, MinimumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(max_uint8_vec, unary_vec<sf_uint8_t, sf_uint8_t, MaximumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(max_uint16_vec, unary_vec<sf_uint16_t, sf_uint16_t, MaximumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(prefix_sum_uint8_vec, unary_vec<sf_uint8_t, sf_uint8_t, PrefixSumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(prefix_sum_uint16_vec, unary_vec<sf_uint16_t, sf_uint16_t, PrefixSumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_uint8_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_uint16_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_uint8_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_uint16_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_uint8_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_uint16_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_uint8_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_uint16_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_uint8_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_uint16_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_uint8_to_bool_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_uint16_to_bool_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_uint8_to_bool_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_uint16_to_bool_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_uint8_to_bool_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_uint16_to_bool_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_uint8_to_bool_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_uint16_to_bool_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_uint8_to_bool_vec, binary_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_uint16_to_bool_vec, binary_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_uint8_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_uint16_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_uint8_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_uint16_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_uint8_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_uint16_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_uint8_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_uint16_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_uint8_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_uint16_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_uint8_to_bool_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_uint16_to_bool_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_uint8_to_bool_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_uint16_to_bool_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_uint8_to_bool_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_uint16_to_bool_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_uint8_to_bool_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_uint16_to_bool_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_uint8_to_bool_vec, binary_public_vec<sf_uint8_t, sf_uint8_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_uint16_to_bool_vec, binary_public_vec<sf_uint16_t, sf_uint16_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_bool_vec, binary_vec<sf_bool_t, sf_bool_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint16_to_uint8_vec, unary_vec<sf_uint16_t, sf_uint8_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint8_to_uint16_vec, unary_vec<sf_uint8_t, sf_uint16_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint32_to_uint8_vec, unary_vec<sf_uint32_t, sf_uint8_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint8_to_uint32_vec, unary_vec<sf_uint8_t, sf_uint32_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint32_to_uint16_vec, unary_vec<sf_uint32_t, sf_uint16_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint16_to_uint32_vec, unary_vec<sf_uint16_t, sf_uint32_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint64_to_uint8_vec, unary_vec<sf_uint64_t, sf_uint8_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint8_to_uint64_vec, unary_vec<sf_uint8_t, sf_uint64_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint64_to_uint16_vec, unary_vec<sf_uint64_t, sf_uint16_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint16_to_uint64_vec, unary_vec<sf_uint16_t, sf_uint64_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_bool_to_uint8_vec, unary_vec<sf_bool_t, sf_uint8_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint8_to_bool_vec, unary_vec<sf_uint8_t, sf_bool_t, BoolConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_bool_to_uint16_vec, unary_vec<sf_bool_t, sf_uint16_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint16_to_bool_vec, unary_vec<sf_uint16_t, sf_bool_t, BoolConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_bool_to_uint32_vec, unary_vec<sf_bool_t, sf_uint32_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint32_to_bool_vec, unary_vec<sf_uint32_t, sf_bool_t, BoolConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_bool_to_uint64_vec, unary_vec<sf_bool_t, sf_uint64_t, ConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_uint64_to_bool_vec, unary_vec<sf_uint64_t, sf_bool_t, BoolConversionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(choose_bool_vec, ternary_vec<sf_bool_t, sf_bool_t, sf_bool_t, sf_bool_t, ObliviousChoiceProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(choose_uint8_vec, ternary_vec<sf_uint8_t, sf_uint8_t, sf_uint8_t, sf_uint8_t, ObliviousChoiceProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(choose_uint16_vec, ternary_vec<sf_uint16_t, sf_uint16_t, sf_uint16_t, sf_uint16_t, ObliviousChoiceProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shuffle_uint8_vec, shuffle_vec<sf_uint8_t>)
+NAMED_SYSCALL_WRAPPER(sort_uint8_vec, unary_vec<sf_uint8_t, sf_uint8_t, SortProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sort_by_key_uint8_vec, binary_arith_vec<sf_uint8_t, SortByKeyProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shuffle_uint16_vec, shuffle_vec<sf_uint16_t>)
+NAMED_SYSCALL_WRAPPER(sort_uint16_vec, unary_vec<sf_uint16_t, sf_uint16_t, SortProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sort_by_key_uint16_vec, binary_arith_vec<sf_uint16_t, SortByKeyProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(new_fix64_vec, new_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(init_fix64_vec, init_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(set_shares_fix64_vec, set_shares<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(get_shares_fix64_vec, get_shares<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(fill_fix64_vec, fill_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(assign_fix64_vec, assign_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(delete_fix64_vec, delete_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(resize_fix64_vec, resize_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(reserve_fix64_vec, reserve_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(load_fix64_vec, load_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(store_fix64_vec, store_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(gather_fix64_vec, gather_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(scatter_fix64_vec, scatter_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(slice_fix64_vec, slice_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(concat_fix64_vec, concat_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(copy_range_fix64_vec, copy_range_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(classify_fix64_vec, classify_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(classify_file_fix64_vec, classify_file_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(declassify_fix64_vec, declassify_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(declassify_file_fix64_vec, declassify_file_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(get_type_size_fix64, get_type_size<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(add_fix64_vec, binary_arith_vec<sf_fix64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_fix64_vec, binary_arith_vec<sf_fix64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_fix64_vec, binary_arith_vec<sf_fix64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(div_fix64_vec, binary_arith_vec<sf_fix64_t, FixedDivisionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(add_public_fix64_vec, binary_arith_public_vec<sf_fix64_t, AdditionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sub_public_fix64_vec, binary_arith_public_vec<sf_fix64_t, SubtractionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(mul_public_fix64_vec, binary_arith_public_vec<sf_fix64_t, MultiplicationProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(div_public_fix64_vec, binary_arith_public_vec<sf_fix64_t, FixedDivisionProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sqrt_fix64_vec, unary_arith_vec<sf_fix64_t, FixedSqrtProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(sum_fix64_vec, unary_vec<sf_fix64_t, sf_fix64_t, SumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(min_fix64_vec, unary_vec<sf_fix64_t, sf_fix64_t, MinimumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(max_fix64_vec, unary_vec<sf_fix64_t, sf_fix64_t, MaximumProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_fix64_to_bool_vec, binary_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_fix64_to_bool_vec, binary_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_fix64_to_bool_vec, binary_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_fix64_to_bool_vec, binary_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_fix64_to_bool_vec, binary_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(eq_public_fix64_to_bool_vec, binary_public_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, EqualityProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gt_public_fix64_to_bool_vec, binary_public_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, GreaterThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(gte_public_fix64_to_bool_vec, binary_public_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, GreaterThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lt_public_fix64_to_bool_vec, binary_public_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, LessThanProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(lte_public_fix64_to_bool_vec, binary_public_vec<sf_fix64_t, sf_fix64_t, sf_bool_t, LessThanOrEqualProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_int64_to_fix64_vec, unary_vec<sf_int64_t, sf_fix64_t, IntToFixedProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(conv_fix64_to_int64_vec, unary_vec<sf_fix64_t, sf_int64_t, FixedToIntProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(choose_fix64_vec, ternary_vec<sf_bool_t, sf_fix64_t, sf_fix64_t, sf_fix64_t, ObliviousChoiceProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(shuffle_fix64_vec, shuffle_vec<sf_fix64_t>)
+NAMED_SYSCALL_WRAPPER(sort_fix64_vec, unary_vec<sf_fix64_t, sf_fix64_t, SortProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_bool_vec, binary_arith_vec<sf_bool_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_bool_vec, binary_arith_vec<sf_bool_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_bool_vec, binary_arith_vec<sf_bool_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_uint8_vec, binary_arith_vec<sf_uint8_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_uint16_vec, binary_arith_vec<sf_uint16_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_uint32_vec, binary_arith_vec<sf_uint32_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_uint64_vec, binary_arith_vec<sf_uint64_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_uint8_vec, binary_arith_vec<sf_uint8_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_uint16_vec, binary_arith_vec<sf_uint16_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_uint32_vec, binary_arith_vec<sf_uint32_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_uint64_vec, binary_arith_vec<sf_uint64_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_uint8_vec, binary_arith_vec<sf_uint8_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_uint16_vec, binary_arith_vec<sf_uint16_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_uint32_vec, binary_arith_vec<sf_uint32_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_uint64_vec, binary_arith_vec<sf_uint64_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_public_uint8_vec, binary_arith_public_vec<sf_uint8_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_public_uint16_vec, binary_arith_public_vec<sf_uint16_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(and_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, BitwiseAndProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_public_uint8_vec, binary_arith_public_vec<sf_uint8_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_public_uint16_vec, binary_arith_public_vec<sf_uint16_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(or_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, BitwiseOrProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_public_uint8_vec, binary_arith_public_vec<sf_uint8_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_public_uint16_vec, binary_arith_public_vec<sf_uint16_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_public_uint32_vec, binary_arith_public_vec<sf_uint32_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(xor_public_uint64_vec, binary_arith_public_vec<sf_uint64_t, BitwiseXorProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(popcount_uint8_vec, unary_arith_vec<sf_uint8_t, PopCountProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(popcount_uint16_vec, unary_arith_vec<sf_uint16_t, PopCountProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(popcount_uint32_vec, unary_arith_vec<sf_uint32_t, PopCountProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(popcount_uint64_vec, unary_arith_vec<sf_uint64_t, PopCountProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(bit_extract_uint8_vec, unary_vec<sf_uint8_t, sf_bool_t, BitExtractProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(bit_extract_uint16_vec, unary_vec<sf_uint16_t, sf_bool_t, BitExtractProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(bit_extract_uint32_vec, unary_vec<sf_uint32_t, sf_bool_t, BitExtractProtocol<SpdzFrescoPDPI>>)
+NAMED_SYSCALL_WRAPPER(bit_extract_uint64_vec, unary_vec<sf_uint64_t, sf_bool_t, BitExtractProtocol<SpdzFrescoPDPI>>)
 
 
 SHAREMIND_MODULE_API_0x1_SYSCALL_DEFINITIONS(
@@ -181,16 +669,55 @@ SHAREMIND_MODULE_API_0x1_SYSCALL_DEFINITIONS(
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::assign_uint64_vec", assign_uint64_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::delete_uint32_vec", delete_uint32_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::delete_uint64_vec", delete_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::resize_uint32_vec", resize_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::resize_uint64_vec", resize_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::reserve_uint32_vec", reserve_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::reserve_uint64_vec", reserve_uint64_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::load_uint32_vec", load_uint32_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::load_uint64_vec", load_uint64_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::store_uint32_vec", store_uint32_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::store_uint64_vec", store_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gather_uint32_vec", gather_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gather_uint64_vec", gather_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::scatter_uint32_vec", scatter_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::scatter_uint64_vec", scatter_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::slice_uint32_vec", slice_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::slice_uint64_vec", slice_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::concat_uint32_vec", concat_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::concat_uint64_vec", concat_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::copy_range_uint32_vec", copy_range_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::copy_range_uint64_vec", copy_range_uint64_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_uint32_vec", classify_uint32_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_uint64_vec", classify_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_file_uint32_vec", classify_file_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_file_uint64_vec", classify_file_uint64_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_uint32_vec", declassify_uint32_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_uint64_vec", declassify_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_file_uint32_vec", declassify_file_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_file_uint64_vec", declassify_file_uint64_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_type_size_uint32", get_type_size_uint32)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_type_size_uint64", get_type_size_uint64)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::new_bool_vec", new_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::delete_bool_vec", delete_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::resize_bool_vec", resize_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::reserve_bool_vec", reserve_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_shares_bool_vec", get_shares_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_bool_vec", declassify_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_file_bool_vec", declassify_file_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_type_size_bool", get_type_size_bool)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::init_bool_vec", init_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::set_shares_bool_vec", set_shares_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fill_bool_vec", fill_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::assign_bool_vec", assign_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::load_bool_vec", load_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::store_bool_vec", store_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gather_bool_vec", gather_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::scatter_bool_vec", scatter_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::slice_bool_vec", slice_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::concat_bool_vec", concat_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::copy_range_bool_vec", copy_range_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_bool_vec", classify_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_file_bool_vec", classify_file_bool_vec)
 
     // Unsigned integer arithmetic
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_uint32_vec", add_uint32_vec)
@@ -199,6 +726,54 @@ SHAREMIND_MODULE_API_0x1_SYSCALL_DEFINITIONS(
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_uint64_vec", sub_uint64_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_uint32_vec", mul_uint32_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_uint64_vec", mul_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_public_uint32_vec", add_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_public_uint64_vec", add_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_public_uint32_vec", sub_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_public_uint64_vec", sub_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_public_uint32_vec", mul_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_public_uint64_vec", mul_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::div_uint32_vec", div_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::div_uint64_vec", div_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mod_uint32_vec", mod_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mod_uint64_vec", mod_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shl_uint32_vec", shl_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shl_uint64_vec", shl_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shr_uint32_vec", shr_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shr_uint64_vec", shr_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::div_public_uint32_vec", div_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::div_public_uint64_vec", div_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mod_public_uint32_vec", mod_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mod_public_uint64_vec", mod_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shl_public_uint32_vec", shl_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shl_public_uint64_vec", shl_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shr_public_uint32_vec", shr_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shr_public_uint64_vec", shr_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_uint32_vec", add_assign_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_uint64_vec", add_assign_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_uint32_vec", sub_assign_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_uint64_vec", sub_assign_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_uint32_vec", mul_assign_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_uint64_vec", mul_assign_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_public_uint32_vec", add_assign_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_public_uint64_vec", add_assign_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_public_uint32_vec", sub_assign_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_public_uint64_vec", sub_assign_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_public_uint32_vec", mul_assign_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_public_uint64_vec", mul_assign_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fma_uint32_vec", fma_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fma_uint64_vec", fma_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_add_public_uint32_vec", mul_add_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_add_public_uint64_vec", mul_add_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sum_uint32_vec", sum_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sum_uint64_vec", sum_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::product_uint32_vec", product_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::product_uint64_vec", product_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::min_uint32_vec", min_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::min_uint64_vec", min_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::max_uint32_vec", max_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::max_uint64_vec", max_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::prefix_sum_uint32_vec", prefix_sum_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::prefix_sum_uint64_vec", prefix_sum_uint64_vec)
 
     // Comparisons
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_uint32_vec", eq_uint32_vec)
@@ -211,6 +786,36 @@ SHAREMIND_MODULE_API_0x1_SYSCALL_DEFINITIONS(
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_uint64_vec", lt_uint64_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_uint32_vec", lte_uint32_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_uint64_vec", lte_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_uint32_to_bool_vec", eq_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_uint64_to_bool_vec", eq_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_uint32_to_bool_vec", gt_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_uint64_to_bool_vec", gt_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_uint32_to_bool_vec", gte_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_uint64_to_bool_vec", gte_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_uint32_to_bool_vec", lt_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_uint64_to_bool_vec", lt_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_uint32_to_bool_vec", lte_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_uint64_to_bool_vec", lte_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_uint32_vec", eq_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_uint64_vec", eq_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_uint32_vec", gt_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_uint64_vec", gt_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_uint32_vec", gte_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_uint64_vec", gte_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_uint32_vec", lt_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_uint64_vec", lt_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_uint32_vec", lte_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_uint64_vec", lte_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_uint32_to_bool_vec", eq_public_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_uint64_to_bool_vec", eq_public_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_uint32_to_bool_vec", gt_public_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_uint64_to_bool_vec", gt_public_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_uint32_to_bool_vec", gte_public_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_uint64_to_bool_vec", gte_public_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_uint32_to_bool_vec", lt_public_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_uint64_to_bool_vec", lt_public_uint64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_uint32_to_bool_vec", lte_public_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_uint64_to_bool_vec", lte_public_uint64_to_bool_vec)
 
     // Casting
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint64_to_uint32_vec", conv_uint64_to_uint32_vec)
@@ -219,6 +824,426 @@ SHAREMIND_MODULE_API_0x1_SYSCALL_DEFINITIONS(
     // Special functions
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::choose_uint32_vec", choose_uint32_vec)
   , NAMED_SYSCALL_DEFINITION("spdz_fresco::choose_uint64_vec", choose_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shuffle_uint32_vec", shuffle_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_uint32_vec", sort_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_by_key_uint32_vec", sort_by_key_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shuffle_uint64_vec", shuffle_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_uint64_vec", sort_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_by_key_uint64_vec", sort_by_key_uint64_vec)
+
+  /**
+   *  Shared signed integers
+   */
+
+    // Variable management
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::new_int32_vec", new_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::new_int64_vec", new_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::init_int32_vec", init_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::init_int64_vec", init_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::set_shares_int32_vec", set_shares_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::set_shares_int64_vec", set_shares_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_shares_int32_vec", get_shares_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_shares_int64_vec", get_shares_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fill_int32_vec", fill_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fill_int64_vec", fill_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::assign_int32_vec", assign_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::assign_int64_vec", assign_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::delete_int32_vec", delete_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::delete_int64_vec", delete_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::resize_int32_vec", resize_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::resize_int64_vec", resize_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::reserve_int32_vec", reserve_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::reserve_int64_vec", reserve_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::load_int32_vec", load_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::load_int64_vec", load_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::store_int32_vec", store_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::store_int64_vec", store_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gather_int32_vec", gather_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gather_int64_vec", gather_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::scatter_int32_vec", scatter_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::scatter_int64_vec", scatter_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::slice_int32_vec", slice_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::slice_int64_vec", slice_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::concat_int32_vec", concat_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::concat_int64_vec", concat_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::copy_range_int32_vec", copy_range_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::copy_range_int64_vec", copy_range_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_int32_vec", classify_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_int64_vec", classify_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_file_int32_vec", classify_file_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_file_int64_vec", classify_file_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_int32_vec", declassify_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_int64_vec", declassify_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_file_int32_vec", declassify_file_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_file_int64_vec", declassify_file_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_type_size_int32", get_type_size_int32)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_type_size_int64", get_type_size_int64)
+
+    // Signed integer arithmetic
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_int32_vec", add_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_int64_vec", add_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_int32_vec", sub_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_int64_vec", sub_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_int32_vec", mul_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_int64_vec", mul_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_public_int32_vec", add_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_public_int64_vec", add_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_public_int32_vec", sub_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_public_int64_vec", sub_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_public_int32_vec", mul_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_public_int64_vec", mul_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_int32_vec", add_assign_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_int64_vec", add_assign_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_int32_vec", sub_assign_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_int64_vec", sub_assign_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_int32_vec", mul_assign_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_int64_vec", mul_assign_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_public_int32_vec", add_assign_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_public_int64_vec", add_assign_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_public_int32_vec", sub_assign_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_public_int64_vec", sub_assign_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_public_int32_vec", mul_assign_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_public_int64_vec", mul_assign_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fma_int32_vec", fma_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fma_int64_vec", fma_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_add_public_int32_vec", mul_add_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_add_public_int64_vec", mul_add_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sum_int32_vec", sum_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sum_int64_vec", sum_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::product_int32_vec", product_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::product_int64_vec", product_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::min_int32_vec", min_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::min_int64_vec", min_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::max_int32_vec", max_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::max_int64_vec", max_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::prefix_sum_int32_vec", prefix_sum_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::prefix_sum_int64_vec", prefix_sum_int64_vec)
+
+    // Comparisons
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_int32_vec", eq_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_int64_vec", eq_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_int32_vec", gt_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_int64_vec", gt_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_int32_vec", gte_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_int64_vec", gte_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_int32_vec", lt_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_int64_vec", lt_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_int32_vec", lte_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_int64_vec", lte_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_int32_to_bool_vec", eq_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_int64_to_bool_vec", eq_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_int32_to_bool_vec", gt_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_int64_to_bool_vec", gt_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_int32_to_bool_vec", gte_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_int64_to_bool_vec", gte_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_int32_to_bool_vec", lt_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_int64_to_bool_vec", lt_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_int32_to_bool_vec", lte_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_int64_to_bool_vec", lte_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_int32_vec", eq_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_int64_vec", eq_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_int32_vec", gt_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_int64_vec", gt_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_int32_vec", gte_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_int64_vec", gte_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_int32_vec", lt_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_int64_vec", lt_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_int32_vec", lte_public_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_int64_vec", lte_public_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_int32_to_bool_vec", eq_public_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_int64_to_bool_vec", eq_public_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_int32_to_bool_vec", gt_public_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_int64_to_bool_vec", gt_public_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_int32_to_bool_vec", gte_public_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_int64_to_bool_vec", gte_public_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_int32_to_bool_vec", lt_public_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_int64_to_bool_vec", lt_public_int64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_int32_to_bool_vec", lte_public_int32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_int64_to_bool_vec", lte_public_int64_to_bool_vec)
+
+    // Casting
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_int64_to_int32_vec", conv_int64_to_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_int32_to_int64_vec", conv_int32_to_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_int32_to_uint32_vec", conv_int32_to_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint32_to_int32_vec", conv_uint32_to_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_int64_to_uint64_vec", conv_int64_to_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint64_to_int64_vec", conv_uint64_to_int64_vec)
+
+    // Special functions
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::choose_int32_vec", choose_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::choose_int64_vec", choose_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shuffle_int32_vec", shuffle_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_int32_vec", sort_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_by_key_int32_vec", sort_by_key_int32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shuffle_int64_vec", shuffle_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_int64_vec", sort_int64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_by_key_int64_vec", sort_by_key_int64_vec)
+
+  /**
+   *  Shared 8- and 16-bit unsigned integers and booleans
+   */
+
+    // Variable management
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::new_uint8_vec", new_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::new_uint16_vec", new_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::init_uint8_vec", init_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::init_uint16_vec", init_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::set_shares_uint8_vec", set_shares_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::set_shares_uint16_vec", set_shares_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_shares_uint8_vec", get_shares_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_shares_uint16_vec", get_shares_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fill_uint8_vec", fill_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fill_uint16_vec", fill_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::assign_uint8_vec", assign_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::assign_uint16_vec", assign_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::delete_uint8_vec", delete_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::delete_uint16_vec", delete_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::resize_uint8_vec", resize_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::resize_uint16_vec", resize_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::reserve_uint8_vec", reserve_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::reserve_uint16_vec", reserve_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::load_uint8_vec", load_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::load_uint16_vec", load_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::store_uint8_vec", store_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::store_uint16_vec", store_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gather_uint8_vec", gather_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gather_uint16_vec", gather_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::scatter_uint8_vec", scatter_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::scatter_uint16_vec", scatter_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::slice_uint8_vec", slice_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::slice_uint16_vec", slice_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::concat_uint8_vec", concat_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::concat_uint16_vec", concat_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::copy_range_uint8_vec", copy_range_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::copy_range_uint16_vec", copy_range_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_uint8_vec", classify_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_uint16_vec", classify_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_file_uint8_vec", classify_file_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_file_uint16_vec", classify_file_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_uint8_vec", declassify_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_uint16_vec", declassify_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_file_uint8_vec", declassify_file_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_file_uint16_vec", declassify_file_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_type_size_uint8", get_type_size_uint8)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_type_size_uint16", get_type_size_uint16)
+
+    // Unsigned integer arithmetic
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_uint8_vec", add_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_uint16_vec", add_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_uint8_vec", sub_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_uint16_vec", sub_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_uint8_vec", mul_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_uint16_vec", mul_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_public_uint8_vec", add_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_public_uint16_vec", add_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_public_uint8_vec", sub_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_public_uint16_vec", sub_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_public_uint8_vec", mul_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_public_uint16_vec", mul_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_uint8_vec", add_assign_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_uint16_vec", add_assign_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_uint8_vec", sub_assign_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_uint16_vec", sub_assign_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_uint8_vec", mul_assign_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_uint16_vec", mul_assign_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_public_uint8_vec", add_assign_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_assign_public_uint16_vec", add_assign_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_public_uint8_vec", sub_assign_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_assign_public_uint16_vec", sub_assign_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_public_uint8_vec", mul_assign_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_assign_public_uint16_vec", mul_assign_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fma_uint8_vec", fma_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fma_uint16_vec", fma_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_add_public_uint8_vec", mul_add_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_add_public_uint16_vec", mul_add_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sum_uint8_vec", sum_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sum_uint16_vec", sum_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::product_uint8_vec", product_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::product_uint16_vec", product_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::min_uint8_vec", min_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::min_uint16_vec", min_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::max_uint8_vec", max_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::max_uint16_vec", max_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::prefix_sum_uint8_vec", prefix_sum_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::prefix_sum_uint16_vec", prefix_sum_uint16_vec)
+
+    // Comparisons
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_uint8_vec", eq_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_uint16_vec", eq_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_uint8_vec", gt_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_uint16_vec", gt_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_uint8_vec", gte_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_uint16_vec", gte_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_uint8_vec", lt_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_uint16_vec", lt_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_uint8_vec", lte_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_uint16_vec", lte_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_uint8_to_bool_vec", eq_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_uint16_to_bool_vec", eq_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_uint8_to_bool_vec", gt_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_uint16_to_bool_vec", gt_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_uint8_to_bool_vec", gte_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_uint16_to_bool_vec", gte_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_uint8_to_bool_vec", lt_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_uint16_to_bool_vec", lt_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_uint8_to_bool_vec", lte_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_uint16_to_bool_vec", lte_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_uint8_vec", eq_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_uint16_vec", eq_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_uint8_vec", gt_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_uint16_vec", gt_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_uint8_vec", gte_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_uint16_vec", gte_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_uint8_vec", lt_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_uint16_vec", lt_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_uint8_vec", lte_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_uint16_vec", lte_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_uint8_to_bool_vec", eq_public_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_uint16_to_bool_vec", eq_public_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_uint8_to_bool_vec", gt_public_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_uint16_to_bool_vec", gt_public_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_uint8_to_bool_vec", gte_public_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_uint16_to_bool_vec", gte_public_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_uint8_to_bool_vec", lt_public_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_uint16_to_bool_vec", lt_public_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_uint8_to_bool_vec", lte_public_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_uint16_to_bool_vec", lte_public_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_bool_vec", eq_bool_vec)
+
+    // Casting
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint16_to_uint8_vec", conv_uint16_to_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint8_to_uint16_vec", conv_uint8_to_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint32_to_uint8_vec", conv_uint32_to_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint8_to_uint32_vec", conv_uint8_to_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint32_to_uint16_vec", conv_uint32_to_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint16_to_uint32_vec", conv_uint16_to_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint64_to_uint8_vec", conv_uint64_to_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint8_to_uint64_vec", conv_uint8_to_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint64_to_uint16_vec", conv_uint64_to_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint16_to_uint64_vec", conv_uint16_to_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_bool_to_uint8_vec", conv_bool_to_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint8_to_bool_vec", conv_uint8_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_bool_to_uint16_vec", conv_bool_to_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint16_to_bool_vec", conv_uint16_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_bool_to_uint32_vec", conv_bool_to_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint32_to_bool_vec", conv_uint32_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_bool_to_uint64_vec", conv_bool_to_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_uint64_to_bool_vec", conv_uint64_to_bool_vec)
+
+    // Special functions
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::choose_bool_vec", choose_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::choose_uint8_vec", choose_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::choose_uint16_vec", choose_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shuffle_uint8_vec", shuffle_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_uint8_vec", sort_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_by_key_uint8_vec", sort_by_key_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shuffle_uint16_vec", shuffle_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_uint16_vec", sort_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_by_key_uint16_vec", sort_by_key_uint16_vec)
+
+  /**
+   *  Shared fixed-point numbers
+   */
+
+    // Variable management
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::new_fix64_vec", new_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::init_fix64_vec", init_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::set_shares_fix64_vec", set_shares_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_shares_fix64_vec", get_shares_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::fill_fix64_vec", fill_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::assign_fix64_vec", assign_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::delete_fix64_vec", delete_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::resize_fix64_vec", resize_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::reserve_fix64_vec", reserve_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::load_fix64_vec", load_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::store_fix64_vec", store_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gather_fix64_vec", gather_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::scatter_fix64_vec", scatter_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::slice_fix64_vec", slice_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::concat_fix64_vec", concat_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::copy_range_fix64_vec", copy_range_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_fix64_vec", classify_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::classify_file_fix64_vec", classify_file_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_fix64_vec", declassify_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::declassify_file_fix64_vec", declassify_file_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::get_type_size_fix64", get_type_size_fix64)
+
+    // Fixed-point arithmetic
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_fix64_vec", add_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_fix64_vec", sub_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_fix64_vec", mul_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::div_fix64_vec", div_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::add_public_fix64_vec", add_public_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sub_public_fix64_vec", sub_public_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::mul_public_fix64_vec", mul_public_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::div_public_fix64_vec", div_public_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sqrt_fix64_vec", sqrt_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sum_fix64_vec", sum_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::min_fix64_vec", min_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::max_fix64_vec", max_fix64_vec)
+
+    // Comparisons
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_fix64_to_bool_vec", eq_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_fix64_to_bool_vec", gt_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_fix64_to_bool_vec", gte_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_fix64_to_bool_vec", lt_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_fix64_to_bool_vec", lte_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::eq_public_fix64_to_bool_vec", eq_public_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gt_public_fix64_to_bool_vec", gt_public_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::gte_public_fix64_to_bool_vec", gte_public_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lt_public_fix64_to_bool_vec", lt_public_fix64_to_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::lte_public_fix64_to_bool_vec", lte_public_fix64_to_bool_vec)
+
+    // Casting
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_int64_to_fix64_vec", conv_int64_to_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::conv_fix64_to_int64_vec", conv_fix64_to_int64_vec)
+
+    // Special functions
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::choose_fix64_vec", choose_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::shuffle_fix64_vec", shuffle_fix64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::sort_fix64_vec", sort_fix64_vec)
+
+  /**
+   *  Bitwise operations
+   */
+
+    // Booleans
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_bool_vec", and_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_bool_vec", or_bool_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_bool_vec", xor_bool_vec)
+    // Unsigned integers
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_uint8_vec", and_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_uint16_vec", and_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_uint32_vec", and_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_uint64_vec", and_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_uint8_vec", or_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_uint16_vec", or_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_uint32_vec", or_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_uint64_vec", or_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_uint8_vec", xor_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_uint16_vec", xor_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_uint32_vec", xor_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_uint64_vec", xor_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_public_uint8_vec", and_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_public_uint16_vec", and_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_public_uint32_vec", and_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::and_public_uint64_vec", and_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_public_uint8_vec", or_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_public_uint16_vec", or_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_public_uint32_vec", or_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::or_public_uint64_vec", or_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_public_uint8_vec", xor_public_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_public_uint16_vec", xor_public_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_public_uint32_vec", xor_public_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::xor_public_uint64_vec", xor_public_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::popcount_uint8_vec", popcount_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::popcount_uint16_vec", popcount_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::popcount_uint32_vec", popcount_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::popcount_uint64_vec", popcount_uint64_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::bit_extract_uint8_vec", bit_extract_uint8_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::bit_extract_uint16_vec", bit_extract_uint16_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::bit_extract_uint32_vec", bit_extract_uint32_vec)
+  , NAMED_SYSCALL_DEFINITION("spdz_fresco::bit_extract_uint64_vec", bit_extract_uint64_vec)
 
   /**
    *  Other functions
@@ -261,9 +1286,16 @@ SHAREMIND_MODULE_API_0x1_PD_SHUTDOWN(spdz_fresco_emu_shutdown, w) {
     assert(w->pdHandle);
     assert(w->moduleHandle);
 
+    sharemind::SpdzFrescoPD * const pd =
+        static_cast<sharemind::SpdzFrescoPD *>(w->pdHandle);
+
+    try {
+        pd->logTimeModelStatistics();
+    } catch (...) {}
+
     static_assert(std::is_nothrow_destructible<sharemind::SpdzFrescoPD>::value,
                   "");
-    delete static_cast<sharemind::SpdzFrescoPD *>(w->pdHandle);
+    delete pd;
     #ifndef NDEBUG
     w->pdHandle = nullptr; // Not needed, but may help debugging.
     #endif
@@ -290,10 +1322,33 @@ SHAREMIND_MODULE_API_0x1_PDPI_SHUTDOWN(spdz_fresco_emu_PDPI_shutdown, w) {
     assert(w->pdHandle);
     assert(w->pdProcessHandle);
 
+    sharemind::SpdzFrescoPDPI * const pdpi =
+        static_cast<sharemind::SpdzFrescoPDPI *>(w->pdProcessHandle);
+    const sharemind::SpdzFrescoModule & m =
+        *static_cast<sharemind::SpdzFrescoModule *>(w->moduleHandle);
+
+    try {
+        pdpi->profilingContext().flush();
+    } catch (...) {
+        m.logger().printCurrentException<LogHard::Priority::Error>();
+        m.logger().error() << "Failed to add deferred profiler sections of "
+            "protection domain '" << pdpi->pdName() << "'.";
+    }
+
+    try {
+        const sharemind::VectorPool::Statistics & stats =
+            pdpi->vectorPool().statistics();
+        m.logger().debug() << "Vector pool of protection domain '"
+            << pdpi->pdName() << "': " << stats.allocatedVectors
+            << " allocated, " << stats.reusedVectors << " reused, at most "
+            << stats.peakLiveVectors << " live vectors and "
+            << stats.peakPooledBytes << " pooled bytes.";
+    } catch (...) {}
+
     static_assert(
                 std::is_nothrow_destructible<sharemind::SpdzFrescoPDPI>::value,
                 "");
-    delete static_cast<sharemind::SpdzFrescoPDPI *>(w->pdProcessHandle);
+    delete pdpi;
     #ifndef NDEBUG
     w->pdProcessHandle = nullptr; // Not needed, but may help debugging.
     #endif